@@ -29,6 +29,7 @@
 #include "appender.h"
 #include "layout.h"
 #include "logline.h"
+#include "logrecord.h"
 
 /// Clio namespace.
 namespace clio
@@ -37,7 +38,8 @@ namespace clio
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 appender::appender() :
     _Mybase(),
-    f_( nullptr )
+    f_( nullptr ),
+    threshold_( logLevel::Everything )
 {
 }
 
@@ -45,6 +47,9 @@ appender::appender() :
 appender::~appender()
 {
     removeFormatting();
+
+    for ( filter *f: filters_ )
+        delete f;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -57,13 +62,124 @@ void appender::setFormat( layout *value )
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void appender::setThreshold( logLevel::type value )
+{
+    _Mybase::setProp( PROP_THRESHOLD, logLevel::toString( value ) );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void appender::addFilter( filter *value )
+{
+    if ( value )
+        filters_.push_back( value );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool appender::accepts( const logRecord& record ) const
+{
+    if ( threshold_.load( std::memory_order_relaxed ) < record.level() )
+        return false;
+
+    // first filter to decide wins
+    for ( const filter *f: filters_ )
+    {
+        const filter::decision d( f->decide( record ) );
+
+        if ( filter::Neutral != d )
+            return ( filter::Accept == d );
+    }
+
+    return true;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 void appender::writeLine( const logLine& line )
+{
+    writeLine( line.record() );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void appender::writeLine( const logRecord& record )
+{
+    // take line offered by the logger, only meant for this call
+    offer& o( offered() );
+    sharedLine *shared(( this == o.app ) ? o.line : nullptr );
+
+    o.app = nullptr;
+
+    if ( !accepts( record ) )
+        return;
+
+    if ( !f_ )
+    {
+        std::lock_guard<mutex> guard( m_ );
+
+        // invoke derived class methods
+        write( record.text() );
+        written( record );
+        return;
+    }
+
+    // first of its group formats for the others
+    if ( shared )
+    {
+        if ( !shared->formatted )
+        {
+            shared->line.clear();
+            f_->formatTo( record, shared->line );
+
+            shared->formatted = true;
+        }
+
+        writeFormatted( record, shared->line );
+        return;
+    }
+
+    // format before locking, appenders writing may log themselves so only reuse when idle
+    struct formatted
+    {
+        lineSegments line;
+        bool busy = false;
+    };
+
+    static thread_local formatted local;
+
+    formatted temp;
+    formatted& f( local.busy ? temp : local );
+
+    // released even when writing throws
+    struct claim
+    {
+        explicit claim( bool& value ) : busy( value ) {busy = true;}
+        ~claim() {busy = false;}
+
+        bool& busy;
+    };
+
+    claim hold( f.busy );
+
+    f.line.clear();
+    f_->formatTo( record, f.line );
+
+    writeFormatted( record, f.line );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void appender::writeFormatted( const logRecord& record, const lineSegments& line )
 {
     std::lock_guard<mutex> guard( m_ );
 
-    // invoke derived class method
-    write( f_ ? f_->format( line ) : line.text() );
+    // invoke derived class methods
+    write( line );
+    written( record );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void appender::propertyChanged( const std::string& name )
+{
+    if ( PROP_THRESHOLD == name )
+        threshold_.store( logLevel::fromString( _Mybase::prop<std::string>( name ) ), std::memory_order_relaxed );
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -76,6 +192,14 @@ void appender::removeFormatting()
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+appender::offer& appender::offered()
+{
+    static thread_local offer value = {nullptr, nullptr};
+
+    return value;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 } // namespace clio
 
@@ -25,26 +25,41 @@
 #ifndef APPENDER_H
 #define APPENDER_H
 
+#include "filter.h"
+#include "layout.h"
+#include "loglevel.h"
 #include "propertymap.h"
 
+#include <atomic>
 #include <list>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <string_view>
+#include <vector>
 
 /// Clio namespace.
 namespace clio
 {
 
-class layout;
 class logLine;
+class logRecord;
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// Appender base class.
+/**
+ * Records less severe than the threshold, or dropped by a filter, are skipped before they are
+ * formatted for the appender.
+ *
+ * Properties you may set on any appender:
+ * @arg threshold - least severe level written (i.e. WARN)
+ * @arg filter - filter to run, see filter for how a chain of them decides
+ */
 class appender : public propertyMap
 {
+    friend class logger;
     friend class loggerManager;
 
     typedef appender _Myt;
@@ -52,6 +67,9 @@ class appender : public propertyMap
 
 public:
 
+    /// Threshold property.
+    static constexpr const char *PROP_THRESHOLD = "threshold";
+
     // ========================================================================
     // DTOR
     // ========================================================================
@@ -75,15 +93,52 @@ public:
      */
     virtual void setFormat( layout *value );
 
+    /// Retrieve threshold.
+    /**
+     * @return  least severe level written
+     */
+    virtual logLevel::type threshold() const {return threshold_.load( std::memory_order_relaxed );}
+
+    /// Set threshold.
+    /**
+     * @param[in] value  least severe level written
+     */
+    virtual void setThreshold( logLevel::type value );
+
+    /// Add filter to end of filter chain.
+    /**
+     * @param[in] value  pointer to filter object, owned by the appender from here on
+     */
+    virtual void addFilter( filter *value );
+
+    /// Check if log record passes threshold and filters.
+    /**
+     * @param[in] record  log record
+     * @return  @c true if it should be written, @c false otherwise
+     */
+    bool accepts( const logRecord& record ) const;
+
     // ========================================================================
     // Methods
     // ========================================================================
 
     /// Write the log line to the appender.
     /**
+     * Writes the record of the line. Appenders override writeLine( const logRecord& ) instead.
+     *
      * @param[in] line  log line
      */
-    virtual void writeLine( const logLine& line );
+    virtual void writeLine( const logLine& line ) final;
+
+    /// Write the log record to the appender.
+    /**
+     * The record is formatted on the calling thread, the appender is only locked for writing it.
+     * Loggers may offer a line formatted once for all appenders with equivalent layouts, which is
+     * used instead of formatting again.
+     *
+     * @param[in] record  log record
+     */
+    virtual void writeLine( const logRecord& record );
 
 protected:
 
@@ -107,24 +162,95 @@ protected:
     /// Close the appender.
     virtual void close() {}
 
+    /// Attach appender to pass log records on to.
+    /**
+     * Only appenders wrapping other appenders accept this, see the @c appender-ref property.
+     *
+     * @param[in] value  appender to attach
+     * @return  @c true if attached, @c false otherwise
+     */
+    virtual bool attach( const std::shared_ptr<appender>& value ) {(void) value; return false;}
+
     /// Write line to appender.
     /**
+     * Appenders must implement this.
+     *
      * @param[in] line  log line
      */
     virtual void write( const std::string& line ) = 0;
 
-private:
+    /// Write line to appender.
+    /**
+     * Appenders able to write a line without copying it implement this, the default copies it
+     * for write( const std::string& ). The line is only valid for the duration of the call.
+     *
+     * @param[in] line  log line
+     */
+    virtual void write( std::string_view line ) {write( std::string( line ) );}
+
+    /// Write line made of pieces to appender.
+    /**
+     * Appenders able to write pieces separately implement this, the default joins them.
+     *
+     * @param[in] line  log line
+     */
+    virtual void write( const lineSegments& line ) {write( line.view() );}
+
+    /// Write the formatted log record to the appender.
+    /**
+     * Locks the appender for write() and written().
+     *
+     * @param[in] record  log record
+     * @param[in] line  formatted log record
+     */
+    void writeFormatted( const logRecord& record, const lineSegments& line );
+
+    /// Log record was written to appender.
+    /**
+     * Called with the appender locked, after write().
+     *
+     * @param[in] record  log record
+     */
+    virtual void written( const logRecord& record ) {(void) record;}
+
+    /// Property was set.
+    /**
+     * @param[in] name  property name
+     */
+    virtual void propertyChanged( const std::string& name );
 
     typedef std::mutex mutex;
-    mutable mutex m_;
+    mutable mutex m_;                               ///< Guards writing to the appender.
+
+private:
+
+    /// Line formatted once for appenders with equivalent layouts.
+    struct sharedLine
+    {
+        lineSegments line;
+        bool formatted = false;
+    };
+
+    /// Line offered to the next writeLine() call on this thread.
+    struct offer
+    {
+        const appender *app;                        ///< Appender the line is offered to.
+        sharedLine *line;
+    };
 
     layout *f_;
 
+    std::atomic<logLevel::type> threshold_;
+    std::vector<filter*> filters_;
+
     // ========================================================================
 
     /// Remove appender formatting.
     void removeFormatting();
 
+    /// Retrieve line offered on this thread.
+    static offer& offered();
+
 };
 
 /// Appender pointer object.
@@ -133,6 +259,9 @@ typedef std::shared_ptr<appender> appenderPtr;
 /// Map of appender pointer objects by appender name.
 typedef std::map<std::string, appenderPtr> appenderPtrMap;
 
+/// List of appender pointer objects.
+typedef std::list<appenderPtr> appenderPtrList;
+
 /// Appender weak pointer object.
 typedef std::weak_ptr<appender> appenderWeakPtr;
 
@@ -24,6 +24,7 @@
 
 #include "appenderfactory.h"
 
+#include "appenders/asyncappender.h"
 #include "appenders/consoleappender.h"
 #include "appenders/fileappender.h"
 #include "appenders/rollingfileappender.h"
@@ -35,11 +36,13 @@ namespace clio
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 appender *appenderFactory::create( const std::string& type )
 {
-    if ( "consoleAppender" == type )
+    if ( asyncAppender::TYPE == type )
+        return new asyncAppender();
+    else if ( consoleAppender::TYPE == type )
         return new consoleAppender();
-    else if ( "fileAppender" == type )
+    else if ( fileAppender::TYPE == type )
         return new fileAppender();
-    else if ( "rollingFileAppender" == type )
+    else if ( rollingFileAppender::TYPE == type )
         return new rollingFileAppender();
 
     return nullptr;
@@ -0,0 +1,477 @@
+/**
+ * @file asyncappender.cpp
+ * @brief Asynchronous appender class.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "asyncappender.h"
+
+#include "../callsite.h"
+
+#include <string>
+#include <utility>
+
+/// Clio namespace.
+namespace clio
+{
+
+/// Call site of records reporting dropped records.
+static const callSite droppedSite( logLevel::Warning, __FILE__, functionName( "", "asyncAppender", "run" ), __LINE__ );
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+asyncAppender::asyncAppender() :
+    _Mybase(),
+    mask_( 0 ),
+    head_( 0 ),
+    tail_( 0 ),
+    policy_( Block ),
+    overflowLevel_( logLevel::Warning ),
+    open_( false ),
+    waiting_( false ),
+    blocked_( 0 ),
+    stop_( false ),
+    dropped_( 0 ),
+    discarded_( 0 )
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+asyncAppender::~asyncAppender()
+{
+    close();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+std::size_t asyncAppender::bufferSize() const
+{
+    bool found;
+    const std::size_t value( _Mybase::prop<std::size_t>( PROP_BUFFERSIZE, &found ) );
+
+    return ( found ? value : DEFAULT_BUFFER_SIZE );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void asyncAppender::setBufferSize( std::size_t value )
+{
+    _Mybase::setProp( PROP_BUFFERSIZE, value );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+asyncAppender::overflowPolicyType asyncAppender::overflowPolicy() const
+{
+    return policyFromString( _Mybase::prop<std::string>( PROP_OVERFLOWPOLICY ) );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void asyncAppender::setOverflowPolicy( overflowPolicyType value )
+{
+    _Mybase::setProp( PROP_OVERFLOWPOLICY, policyToString( value ) );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+logLevel::type asyncAppender::overflowLevel() const
+{
+    bool found;
+    const logLevel::type value( logLevel::fromString( _Mybase::prop<std::string>( PROP_OVERFLOWLEVEL, &found ) ) );
+
+    return ( found ? value : logLevel::Warning );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void asyncAppender::setOverflowLevel( logLevel::type value )
+{
+    _Mybase::setProp( PROP_OVERFLOWLEVEL, logLevel::toString( value ) );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+std::chrono::milliseconds asyncAppender::shutdownTimeout() const
+{
+    bool found;
+    const unsigned int value( _Mybase::prop<unsigned int>( PROP_SHUTDOWNTIMEOUT, &found ) );
+
+    return std::chrono::milliseconds( found ? value : DEFAULT_SHUTDOWN_TIMEOUT );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void asyncAppender::setShutdownTimeout( const std::chrono::milliseconds& value )
+{
+    _Mybase::setProp( PROP_SHUTDOWNTIMEOUT, (unsigned int) value.count() );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void asyncAppender::writeLine( const logRecord& record )
+{
+    if ( !accepts( record ) )
+        return;
+
+    if ( !open_.load( std::memory_order_acquire ) )
+    {
+        discarded_.fetch_add( 1, std::memory_order_relaxed );
+        return;
+    }
+
+    while ( !push( record ) )
+    {
+        // make room
+        if ( DropOldest == policy_ )
+        {
+            std::optional<logRecord> oldest;
+
+            if ( pop( oldest ) )
+                dropped_.fetch_add( 1, std::memory_order_relaxed );
+
+            continue;
+        }
+
+        const bool drop(( DropNewest == policy_ ) || (( DropBelowLevel == policy_ ) && ( overflowLevel_ < record.level() )));
+
+        if ( drop )
+        {
+            dropped_.fetch_add( 1, std::memory_order_relaxed );
+            return;
+        }
+
+        // closing, nobody will make room
+        if ( !open_.load( std::memory_order_acquire ) )
+        {
+            discarded_.fetch_add( 1, std::memory_order_relaxed );
+            return;
+        }
+
+        // wait for room
+        waitForRoom();
+    }
+
+    notify();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool asyncAppender::open()
+{
+    if ( writer_.joinable() )
+        return true;
+
+    if ( targets_.empty() )
+        return false;
+
+    // round up to a power of two so positions map to slots with a mask
+    std::size_t size( 2 );
+
+    while ( size < bufferSize() )
+        size <<= 1;
+
+    slots_ = std::vector<slot>( size );
+
+    for ( std::size_t i = 0; i < size; ++i )
+        slots_[i].seq.store( i, std::memory_order_relaxed );
+
+    mask_ = size - 1;
+    head_.store( 0, std::memory_order_relaxed );
+    tail_.store( 0, std::memory_order_relaxed );
+
+    policy_ = overflowPolicy();
+    overflowLevel_ = overflowLevel();
+
+    stop_ = false;
+    open_.store( true, std::memory_order_release );
+
+    writer_ = std::thread( &asyncAppender::run, this );
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void asyncAppender::close()
+{
+    if ( !writer_.joinable() )
+        return;
+
+    {
+        std::lock_guard<std::mutex> guard( wakeMutex_ );
+
+        stop_ = true;
+        deadline_ = std::chrono::steady_clock::now() + shutdownTimeout();
+
+        // new records are discarded from here on
+        open_.store( false, std::memory_order_release );
+
+        wake_.notify_all();
+        room_.notify_all();
+    }
+
+    writer_.join();
+    writer_ = std::thread();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool asyncAppender::attach( const appenderPtr& value )
+{
+    if ( writer_.joinable() )
+        return false;
+
+    targets_.push_back( value );
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool asyncAppender::push( const logRecord& record )
+{
+    std::size_t pos( tail_.load( std::memory_order_relaxed ) );
+
+    for ( ;; )
+    {
+        slot& s( slots_[pos & mask_] );
+        const std::size_t seq( s.seq.load( std::memory_order_acquire ) );
+
+        // slot is free for this position, claim it
+        if ( seq == pos )
+        {
+            if ( tail_.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) )
+            {
+                s.record.emplace( record );
+
+                // queued copy must not write itself to the logger when destroyed
+                s.record->setLog( nullptr );
+
+                s.seq.store( pos + 1, std::memory_order_release );
+                return true;
+            }
+        }
+
+        // slot still holds the record from one lap ago, full
+        else if ( seq < pos )
+            return false;
+
+        // another thread claimed this position
+        else
+        {
+            pos = tail_.load( std::memory_order_relaxed );
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool asyncAppender::pop( std::optional<logRecord>& record )
+{
+    std::size_t pos( head_.load( std::memory_order_relaxed ) );
+
+    for ( ;; )
+    {
+        slot& s( slots_[pos & mask_] );
+        const std::size_t seq( s.seq.load( std::memory_order_acquire ) );
+
+        // slot holds a record for this position, claim it
+        if ( seq == pos + 1 )
+        {
+            if ( head_.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) )
+            {
+                record.emplace( std::move( *s.record ) );
+                s.record.reset();
+
+                s.seq.store( pos + mask_ + 1, std::memory_order_release );
+                return true;
+            }
+        }
+
+        // slot not written yet, empty
+        else if ( seq < pos + 1 )
+            return false;
+
+        // another thread claimed this position
+        else
+        {
+            pos = head_.load( std::memory_order_relaxed );
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void asyncAppender::notify()
+{
+    // pairs with the store in run(), so either we see it waiting or it sees our record
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+
+    if ( waiting_.load( std::memory_order_relaxed ) )
+    {
+        std::lock_guard<std::mutex> guard( wakeMutex_ );
+        wake_.notify_one();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool asyncAppender::full() const
+{
+    const std::size_t pos( tail_.load( std::memory_order_relaxed ) );
+
+    return ( slots_[pos & mask_].seq.load( std::memory_order_acquire ) < pos );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void asyncAppender::waitForRoom()
+{
+    // the queue is full, so we must be sure the writer is emptying it
+    notify();
+
+    std::unique_lock<std::mutex> lock( wakeMutex_ );
+
+    blocked_.fetch_add( 1, std::memory_order_relaxed );
+
+    // pairs with the fence in released(), so either we see the room or it sees us waiting
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+
+    room_.wait( lock, [this] {return (( !full() ) || ( !open_.load( std::memory_order_acquire ) ));} );
+
+    blocked_.fetch_sub( 1, std::memory_order_relaxed );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void asyncAppender::released()
+{
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+
+    if ( blocked_.load( std::memory_order_relaxed ) )
+    {
+        std::lock_guard<std::mutex> guard( wakeMutex_ );
+        room_.notify_all();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void asyncAppender::run()
+{
+    std::optional<logRecord> record;
+    std::uint64_t reported( 0 );
+
+    bool stopping( false );
+    std::chrono::steady_clock::time_point deadline;
+
+    for ( ;; )
+    {
+        while ( pop( record ) )
+        {
+            released();
+
+            if (( !stopping ) && ( !open_.load( std::memory_order_acquire ) ))
+            {
+                std::lock_guard<std::mutex> guard( wakeMutex_ );
+
+                stopping = true;
+                deadline = deadline_;
+            }
+
+            // out of time, discard the rest
+            if (( stopping ) && ( deadline <= std::chrono::steady_clock::now() ))
+            {
+                std::uint64_t count( 1 );
+
+                while ( pop( record ) )
+                    ++count;
+
+                discarded_.fetch_add( count, std::memory_order_relaxed );
+                break;
+            }
+
+            pass( *record );
+        }
+
+        // let the log know records went missing
+        const std::uint64_t dropped( dropped_.load( std::memory_order_relaxed ) );
+
+        if ( reported != dropped )
+        {
+            logRecord temp( droppedSite, nullptr, droppedSite.level() );
+            temp.appendText( "asyncAppender dropped %llu log records, queue full", (unsigned long long) (dropped - reported) );
+
+            pass( temp );
+            reported = dropped;
+        }
+
+        std::unique_lock<std::mutex> lock( wakeMutex_ );
+
+        if ( stop_ )
+        {
+            if ( stopping )
+                break;
+
+            // one more pass to pick up records queued before the producers saw we are closing
+            stopping = true;
+            deadline = deadline_;
+            continue;
+        }
+
+        waiting_.store( true, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+
+        // check again now that producers will notify us
+        if ( pop( record ) )
+        {
+            waiting_.store( false, std::memory_order_relaxed );
+            lock.unlock();
+
+            released();
+
+            pass( *record );
+            continue;
+        }
+
+        wake_.wait_for( lock, std::chrono::milliseconds( 100 ) );
+        waiting_.store( false, std::memory_order_relaxed );
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void asyncAppender::pass( const logRecord& record )
+{
+    for ( const appenderPtr& i: targets_ )
+        i->writeLine( record );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+asyncAppender::overflowPolicyType asyncAppender::policyFromString( const std::string& value )
+{
+    if ( "dropNewest" == value )
+        return DropNewest;
+    else if ( "dropOldest" == value )
+        return DropOldest;
+    else if ( "dropBelowLevel" == value )
+        return DropBelowLevel;
+
+    return Block;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+std::string asyncAppender::policyToString( overflowPolicyType value )
+{
+    if ( DropNewest == value )
+        return "dropNewest";
+    else if ( DropOldest == value )
+        return "dropOldest";
+    else if ( DropBelowLevel == value )
+        return "dropBelowLevel";
+
+    return "block";
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace clio
@@ -0,0 +1,291 @@
+/**
+ * @file asyncappender.h
+ * @brief Asynchronous appender class.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ASYNCAPPENDER_H
+#define ASYNCAPPENDER_H
+
+#include "../appender.h"
+#include "../loglevel.h"
+#include "../logrecord.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+/// Clio namespace.
+namespace clio
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Asynchronous appender class.
+/**
+ * This appender queues log records and writes them to other appenders from a background thread,
+ * so the logging thread does not pay for layout formatting or file output. The appenders written
+ * to are named with @c appender-ref and must be defined before this one.
+ *
+ * When the queue is full the overflow policy decides what happens:
+ * @arg block - wait for room
+ * @arg dropNewest - discard the record being logged
+ * @arg dropOldest - discard the oldest queued record
+ * @arg dropBelowLevel - discard the record being logged if less severe than overflowLevel,
+ *   otherwise wait for room
+ *
+ * Records written to the appender while it closes are discarded. Closing writes out queued
+ * records for up to shutdownTimeout, whatever is left after that is discarded too. Properties
+ * take effect when the appender is opened.
+ *
+ * Properties you may set:
+ * @arg appender-ref [required] - name of appender to write to, may be given more than once
+ * @arg bufferSize - how many records can be queued, rounded up to a power of two
+ * @arg overflowPolicy - block, dropNewest, dropOldest or dropBelowLevel
+ * @arg overflowLevel - least severe level not dropped by dropBelowLevel (i.e. WARN)
+ * @arg shutdownTimeout - how long closing may take writing out queued records (in ms)
+ */
+class asyncAppender : public appender
+{
+    typedef asyncAppender _Myt;
+    typedef appender _Mybase;
+
+public:
+
+    /// Appender type, as named in config files.
+    static constexpr const char *TYPE = "asyncAppender";
+
+    /// Buffer size property.
+    static constexpr const char *PROP_BUFFERSIZE = "bufferSize";
+
+    /// Overflow policy property.
+    static constexpr const char *PROP_OVERFLOWPOLICY = "overflowPolicy";
+
+    /// Overflow level property.
+    static constexpr const char *PROP_OVERFLOWLEVEL = "overflowLevel";
+
+    /// Shutdown timeout property.
+    static constexpr const char *PROP_SHUTDOWNTIMEOUT = "shutdownTimeout";
+
+    static const std::size_t DEFAULT_BUFFER_SIZE = 1024;               ///< Default buffer size.
+    static const unsigned int DEFAULT_SHUTDOWN_TIMEOUT = 5000;         ///< Default shutdown timeout.
+
+    /// Overflow policies.
+    enum overflowPolicyType
+    {
+        Block,                                      ///< wait for room
+        DropNewest,                                 ///< discard record being logged
+        DropOldest,                                 ///< discard oldest queued record
+        DropBelowLevel,                             ///< discard less severe records, wait for others
+    };
+
+    // ========================================================================
+    // CTOR / DTOR
+    // ========================================================================
+
+    /// Constructor.
+    asyncAppender();
+
+    /// Destructor.
+    virtual ~asyncAppender();
+
+    // ========================================================================
+    // Properties
+    // ========================================================================
+
+    /// Retrieve buffer size.
+    /**
+     * @return  how many records can be queued
+     */
+    virtual std::size_t bufferSize() const;
+
+    /// Set buffer size.
+    /**
+     * @param[in] value  how many records can be queued
+     */
+    virtual void setBufferSize( std::size_t value );
+
+    /// Retrieve overflow policy.
+    /**
+     * @return  overflow policy
+     */
+    virtual overflowPolicyType overflowPolicy() const;
+
+    /// Set overflow policy.
+    /**
+     * @param[in] value  overflow policy
+     */
+    virtual void setOverflowPolicy( overflowPolicyType value );
+
+    /// Retrieve overflow level.
+    /**
+     * @return  least severe level not dropped by the DropBelowLevel policy
+     */
+    virtual logLevel::type overflowLevel() const;
+
+    /// Set overflow level.
+    /**
+     * @param[in] value  least severe level not dropped by the DropBelowLevel policy
+     */
+    virtual void setOverflowLevel( logLevel::type value );
+
+    /// Retrieve shutdown timeout.
+    /**
+     * @return  how long closing may take writing out queued records
+     */
+    virtual std::chrono::milliseconds shutdownTimeout() const;
+
+    /// Set shutdown timeout.
+    /**
+     * @param[in] value  how long closing may take writing out queued records
+     */
+    virtual void setShutdownTimeout( const std::chrono::milliseconds& value );
+
+    /// Retrieve number of records dropped because the queue was full.
+    /**
+     * @return  dropped record count
+     */
+    std::uint64_t droppedCount() const {return dropped_.load( std::memory_order_relaxed );}
+
+    /// Retrieve number of records discarded because the appender was closing.
+    /**
+     * @return  discarded record count
+     */
+    std::uint64_t discardedCount() const {return discarded_.load( std::memory_order_relaxed );}
+
+    // ========================================================================
+    // Methods
+    // ========================================================================
+
+    /// Queue the log record for the background thread.
+    /**
+     * @param[in] record  log record
+     */
+    virtual void writeLine( const logRecord& record );
+
+protected:
+
+    // ========================================================================
+    // Methods
+    // ========================================================================
+
+    /// Open the appender.
+    /**
+     * @return  @c true if opened successfully, @c false otherwise
+     */
+    virtual bool open();
+
+    /// Close the appender.
+    virtual void close();
+
+    /// Attach appender to pass log records on to.
+    /**
+     * @param[in] value  appender to attach
+     * @return  @c true if attached, @c false otherwise
+     */
+    virtual bool attach( const appenderPtr& value );
+
+    /// Write line to appender.
+    /**
+     * Not used, records are passed on to the attached appenders unformatted.
+     *
+     * @param[in] line  log line
+     */
+    virtual void write( const std::string& line ) {(void) line;}
+
+private:
+
+    /// Queue slot.
+    struct slot
+    {
+        std::atomic<std::size_t> seq;
+        std::optional<logRecord> record;
+    };
+
+    appenderPtrList targets_;
+
+    std::vector<slot> slots_;
+    std::size_t mask_;
+
+    std::atomic<std::size_t> head_;
+    std::atomic<std::size_t> tail_;
+
+    overflowPolicyType policy_;
+    logLevel::type overflowLevel_;
+
+    std::atomic<bool> open_;
+    std::atomic<bool> waiting_;
+    std::atomic<unsigned int> blocked_;
+
+    std::mutex wakeMutex_;
+    std::condition_variable wake_;
+    std::condition_variable room_;
+    std::thread writer_;
+    bool stop_;
+    std::chrono::steady_clock::time_point deadline_;
+
+    std::atomic<std::uint64_t> dropped_;
+    std::atomic<std::uint64_t> discarded_;
+
+    // ========================================================================
+
+    /// Add record to queue.
+    bool push( const logRecord& record );
+
+    /// Remove oldest record from queue.
+    bool pop( std::optional<logRecord>& record );
+
+    /// Check if queue is full.
+    bool full() const;
+
+    /// Wait until background thread makes room, or closing.
+    void waitForRoom();
+
+    /// Wake producers waiting for room.
+    void released();
+
+    /// Wake background thread if waiting for records.
+    void notify();
+
+    /// Write queued records.
+    void run();
+
+    /// Pass record on to attached appenders.
+    void pass( const logRecord& record );
+
+    /// Convert overflow policy from string.
+    static overflowPolicyType policyFromString( const std::string& value );
+
+    /// Convert overflow policy to string.
+    static std::string policyToString( overflowPolicyType value );
+
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace clio
+
+#endif // ASYNCAPPENDER_H
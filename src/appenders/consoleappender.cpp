@@ -42,11 +42,17 @@ consoleAppender::~consoleAppender()
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
-void consoleAppender::write( const std::string& line )
+void consoleAppender::write( std::string_view line )
 {
     std::cout << line;
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void consoleAppender::write( const lineSegments& line )
+{
+    line.forEach( []( std::string_view piece, bool ) {std::cout << piece;} );
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 } // namespace clio
 
@@ -44,6 +44,9 @@ class consoleAppender : public appender
 
 public:
 
+    /// Appender type, as named in config files.
+    static constexpr const char *TYPE = "consoleAppender";
+
     // ========================================================================
     // CTOR / DTOR
     // ========================================================================
@@ -64,7 +67,19 @@ protected:
     /**
      * @param[in] line  log line
      */
-    virtual void write( const std::string& line );
+    virtual void write( const std::string& line ) {write( std::string_view( line ) );}
+
+    /// Write line to appender.
+    /**
+     * @param[in] line  log line
+     */
+    virtual void write( std::string_view line );
+
+    /// Write line made of pieces to appender.
+    /**
+     * @param[in] line  log line
+     */
+    virtual void write( const lineSegments& line );
 
 };
 
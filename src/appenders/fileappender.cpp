@@ -24,13 +24,42 @@
 
 #include "fileappender.h"
 
+#include "../logrecord.h"
+
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+
+#if _WIN32
+#include <io.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#include <climits>
+
 /// Clio namespace.
 namespace clio
 {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 fileAppender::fileAppender() :
-    _Mybase()
+    _Mybase(),
+    fd_( -1 ),
+    pos_( 0 ),
+    capacity_( 0 ),
+    appended_( 0 ),
+    durable_( 0 ),
+    opened_( 0 ),
+    writing_( false ),
+    immediateFlushLevel_( logLevel::Error ),
+    idle_( false ),
+    stop_( false )
 {
 }
 
@@ -64,42 +93,388 @@ void fileAppender::setAppendToFile( bool value )
     _Mybase::setProp( PROP_APPENDTOFILE, value );
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+std::size_t fileAppender::bufferSize() const
+{
+    bool found;
+    const std::size_t value( _Mybase::prop<std::size_t>( PROP_BUFFERSIZE, &found ) );
+
+    return ( found ? value : DEFAULT_BUFFER_SIZE );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void fileAppender::setBufferSize( std::size_t value )
+{
+    _Mybase::setProp( PROP_BUFFERSIZE, value );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+std::chrono::milliseconds fileAppender::flushInterval() const
+{
+    bool found;
+    const unsigned int value( _Mybase::prop<unsigned int>( PROP_FLUSHINTERVAL, &found ) );
+
+    return std::chrono::milliseconds( found ? value : DEFAULT_FLUSH_INTERVAL );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void fileAppender::setFlushInterval( const std::chrono::milliseconds& value )
+{
+    _Mybase::setProp( PROP_FLUSHINTERVAL, (unsigned int) value.count() );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+logLevel::type fileAppender::immediateFlushLevel() const
+{
+    bool found;
+    const logLevel::type value( logLevel::fromString( _Mybase::prop<std::string>( PROP_IMMEDIATEFLUSHLEVEL, &found ) ) );
+
+    return ( found ? value : logLevel::Error );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void fileAppender::setImmediateFlushLevel( logLevel::type value )
+{
+    _Mybase::setProp( PROP_IMMEDIATEFLUSHLEVEL, logLevel::toString( value ) );
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 std::size_t fileAppender::pos() const
 {
-    return ( (std::size_t) const_cast<std::ofstream*>( &ofs_ )->tellp() );
+    return ( pos_ + (std::size_t) (appended_ - opened_) );
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 bool fileAppender::open()
 {
+    std::lock_guard<mutex> guard( m_ );
+
+    capacity_ = bufferSize();
+    immediateFlushLevel_ = immediateFlushLevel();
+
+    buffer_.reserve( capacity_ );
+
+    if ( !openFile() )
+        return false;
+
+    // write out lines left waiting when no more come
+    const std::chrono::milliseconds interval( flushInterval() );
+
+    if (( capacity_ ) && ( interval.count() ) && ( !flusher_.joinable() ))
+    {
+        stop_ = false;
+        flusher_ = std::thread( &fileAppender::run, this, interval );
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void fileAppender::close()
+{
+    if ( flusher_.joinable() )
+    {
+        {
+            std::lock_guard<mutex> guard( m_ );
+
+            stop_ = true;
+            wake_.notify_all();
+        }
+
+        flusher_.join();
+        flusher_ = std::thread();
+    }
+
+    std::lock_guard<mutex> guard( m_ );
+    closeFile();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void fileAppender::write( std::string_view line )
+{
+    buffer_.insert( buffer_.end(), line.begin(), line.end() );
+    appended_ += line.size();
+
+    wakeFlusher();
+    bufferFull();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void fileAppender::write( const lineSegments& line )
+{
+    bool borrowed( false );
+
+    line.forEach( [this, &borrowed]( std::string_view piece, bool referenced )
+    {
+        // would be written right away anyway, skip the copy
+        if (( referenced ) && (( !capacity_ ) || ( capacity_ <= piece.size() )))
+        {
+            seal();
+            sealed_.push_back( {buffer_type(), piece} );
+            appended_ += piece.size();
+
+            borrowed = true;
+        }
+        else
+        {
+            buffer_.insert( buffer_.end(), piece.begin(), piece.end() );
+            appended_ += piece.size();
+        }
+    } );
+
+    // borrowed text must be written before the line goes away
+    if ( borrowed )
+        commit( appended_ );
+    else
+    {
+        wakeFlusher();
+        bufferFull();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void fileAppender::written( const logRecord& record )
+{
+    if (( !capacity_ ) || ( record.level() <= immediateFlushLevel_ ))
+        commit( appended_ );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool fileAppender::openFile()
+{
+    if ( 0 <= fd_ )
+        return true;
+
     // retrieve filename
     std::string filename( file() );
 
     if ( filename.empty() )
         return false;
 
-    // open!
-    ofs_.open( filename.c_str(), std::ofstream::out | (appendToFile() ? std::ofstream::app : std::ofstream::trunc) );
+    // open! always append, an appender being replaced may still write out its last lines
+#if _WIN32
+    fd_ = ::_open( filename.c_str(), _O_WRONLY | _O_CREAT | _O_TEXT | _O_APPEND | (appendToFile() ? 0 : _O_TRUNC), _S_IREAD | _S_IWRITE );
+#else
+    fd_ = ::open( filename.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC | O_APPEND | (appendToFile() ? 0 : O_TRUNC), 0644 );
+#endif
 
-    return ofs_.is_open();
+    if ( fd_ < 0 )
+        return false;
+
+    // appending starts at the end, lines still buffered go to this file too
+    struct stat st;
+    pos_ = (( 0 == ::fstat( fd_, &st ) ) ? (std::size_t) st.st_size : 0 );
+    opened_ = durable_;
+
+    return true;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
-void fileAppender::close()
+void fileAppender::closeFile()
 {
-    if ( ofs_.is_open() )
-        ofs_.close();
+    if ( fd_ < 0 )
+        return;
+
+    // other threads may add lines while we write, get those too
+    do
+    {
+        flush();
+
+        while ( writing_ )
+            written_.wait( m_ );
+
+    } while ( durable_ < appended_ );
+
+#if _WIN32
+    ::_close( fd_ );
+#else
+    ::close( fd_ );
+#endif
+
+    fd_ = -1;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
-void fileAppender::write( const std::string& line )
+void fileAppender::flush()
 {
-    ofs_ << line;
-    ofs_.flush();
+    commit( appended_ );
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
-} // namespace clio
+void fileAppender::bufferFull()
+{
+    if (( !capacity_ ) || ( buffer_.size() < capacity_ ))
+        return;
+
+    // somebody is writing, keep collecting unless too far behind
+    if (( writing_ ) && ( sealed_.size() < MAX_SEALED ))
+        seal();
+    else
+        commit( appended_ );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void fileAppender::wakeFlusher()
+{
+    if ( idle_ )
+    {
+        idle_ = false;
+        wake_.notify_all();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void fileAppender::seal()
+{
+    if ( buffer_.empty() )
+        return;
+
+    sealed_.push_back( {std::move( buffer_ ), std::string_view()} );
+
+    if ( spare_.empty() )
+    {
+        buffer_ = buffer_type();
+        buffer_.reserve( capacity_ );
+    }
+    else
+    {
+        buffer_ = std::move( spare_.back() );
+        spare_.pop_back();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void fileAppender::commit( std::uint64_t target )
+{
+    while ( durable_ < target )
+    {
+        // follow, the batch being written may hold our lines
+        if ( writing_ )
+        {
+            written_.wait( m_ );
+            continue;
+        }
+
+        // lead, write out everything collected so far, batches trade their storage
+        writing_ = true;
+        seal();
+
+        batch_.swap( sealed_ );
 
+        m_.unlock();
+        writeFile( batch_ );
+        m_.lock();
 
+        for ( chunk& c: batch_ )
+        {
+            durable_ += c.view().size();
+
+            if ( c.borrowed.data() )
+                continue;
+
+            c.buffer.clear();
+            spare_.push_back( std::move( c.buffer ) );
+        }
+
+        batch_.clear();
+
+        // keep a few buffers around
+        if ( MAX_SEALED < spare_.size() )
+            spare_.resize( MAX_SEALED );
+
+        writing_ = false;
+        written_.notify_all();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void fileAppender::writeFile( std::vector<chunk>& batch )
+{
+    if ( fd_ < 0 )
+        return;
+
+#if _WIN32
+    for ( const chunk& c: batch )
+    {
+        const char *data( c.view().data() );
+        std::size_t len( c.view().size() );
+
+        while ( len )
+        {
+            const int result( ::_write( fd_, data, (unsigned int) len ) );
+
+            // nowhere to report it, lose the rest
+            if ( result < 0 )
+                return;
+
+            data += result;
+            len -= result;
+        }
+    }
+#else
+    // kept per thread, writing allocates only when a batch grows
+    static thread_local std::vector<struct iovec> iov;
+    iov.clear();
+
+    for ( const chunk& c: batch )
+        iov.push_back( {const_cast<char*>( c.view().data() ), c.view().size()} );
+
+    struct iovec *first( iov.data() );
+    int count( (int) iov.size() );
+
+    while ( count )
+    {
+        const ssize_t result( ::writev( fd_, first, (IOV_MAX < count) ? IOV_MAX : count ) );
+
+        if ( result < 0 )
+        {
+            if ( EINTR == errno )
+                continue;
+
+            // nowhere to report it, lose the rest
+            return;
+        }
+
+        // skip what was written
+        std::size_t done( result );
+
+        while (( count ) && ( first->iov_len <= done ))
+        {
+            done -= first->iov_len;
+            ++first;
+            --count;
+        }
+
+        if ( count )
+        {
+            first->iov_base = static_cast<char*>( first->iov_base ) + done;
+            first->iov_len -= done;
+        }
+    }
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void fileAppender::run( std::chrono::milliseconds interval )
+{
+    std::unique_lock<mutex> lock( m_ );
+
+    while ( !stop_ )
+    {
+        // nothing buffered, sleep until lines come
+        if ( durable_ == appended_ )
+        {
+            idle_ = true;
+            wake_.wait( lock, [this] {return (( stop_ ) || ( !idle_ ));} );
+            idle_ = false;
+            continue;
+        }
+
+        // give more lines the interval to join them
+        wake_.wait_for( lock, interval );
+        flush();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace clio
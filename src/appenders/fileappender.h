@@ -26,8 +26,13 @@
 #define FILEAPPENDER_H
 
 #include "../appender.h"
+#include "../loglevel.h"
 
-#include <fstream>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <thread>
+#include <vector>
 
 /// Clio namespace.
 namespace clio
@@ -39,9 +44,21 @@ namespace clio
 /**
  * This appender will output to a file.
  *
+ * Lines are collected in a buffer and written to the file when it fills up, when the oldest line
+ * has waited for flushInterval, or right away for lines at or above immediateFlushLevel. Closing
+ * the appender writes out whatever is left. Buffering properties take effect when the appender is
+ * opened.
+ *
+ * Writes to the file are group commits. While one thread writes a batch, other threads keep
+ * adding lines to the next one, and the next thread needing its lines on disk writes everything
+ * collected so far with a single call.
+ *
  * Properties you may set:
  * @arg file [required] - filename of log
  * @arg appendToFile - true/false value for appending to the file or truncating it
+ * @arg bufferSize - size of buffer (in bytes), 0 writes every line right away
+ * @arg flushInterval - longest a line may wait in the buffer (in ms), 0 to wait until full
+ * @arg immediateFlushLevel - least severe level written right away (i.e. ERROR)
  */
 class fileAppender : public appender
 {
@@ -50,12 +67,27 @@ class fileAppender : public appender
 
 public:
 
+    /// Appender type, as named in config files.
+    static constexpr const char *TYPE = "fileAppender";
+
     /// File property.
     static constexpr const char *PROP_FILE = "file";
 
     /// Append to file property.
     static constexpr const char *PROP_APPENDTOFILE = "appendToFile";
 
+    /// Buffer size property.
+    static constexpr const char *PROP_BUFFERSIZE = "bufferSize";
+
+    /// Flush interval property.
+    static constexpr const char *PROP_FLUSHINTERVAL = "flushInterval";
+
+    /// Immediate flush level property.
+    static constexpr const char *PROP_IMMEDIATEFLUSHLEVEL = "immediateFlushLevel";
+
+    static const std::size_t DEFAULT_BUFFER_SIZE = 8192;               ///< Default buffer size.
+    static const unsigned int DEFAULT_FLUSH_INTERVAL = 1000;           ///< Default flush interval.
+
     // ========================================================================
     // CTOR / DTOR
     // ========================================================================
@@ -94,6 +126,42 @@ public:
      */
     virtual void setAppendToFile( bool value );
 
+    /// Retrieve buffer size.
+    /**
+     * @return  size of buffer (in bytes)
+     */
+    virtual std::size_t bufferSize() const;
+
+    /// Set buffer size.
+    /**
+     * @param[in] value  size of buffer (in bytes), 0 to write every line right away
+     */
+    virtual void setBufferSize( std::size_t value );
+
+    /// Retrieve flush interval.
+    /**
+     * @return  longest a line may wait in the buffer
+     */
+    virtual std::chrono::milliseconds flushInterval() const;
+
+    /// Set flush interval.
+    /**
+     * @param[in] value  longest a line may wait in the buffer, 0 to wait until full
+     */
+    virtual void setFlushInterval( const std::chrono::milliseconds& value );
+
+    /// Retrieve immediate flush level.
+    /**
+     * @return  least severe level written right away
+     */
+    virtual logLevel::type immediateFlushLevel() const;
+
+    /// Set immediate flush level.
+    /**
+     * @param[in] value  least severe level written right away
+     */
+    virtual void setImmediateFlushLevel( logLevel::type value );
+
 protected:
 
     // ========================================================================
@@ -123,11 +191,108 @@ protected:
     /**
      * @param[in] line  log line
      */
-    virtual void write( const std::string& line );
+    virtual void write( const std::string& line ) {write( std::string_view( line ) );}
+
+    /// Write line to appender.
+    /**
+     * @param[in] line  log line
+     */
+    virtual void write( std::string_view line );
+
+    /// Write line made of pieces to appender.
+    /**
+     * Referenced text too large for the buffer is written straight from the line, without
+     * copying it into the buffer first.
+     *
+     * @param[in] line  log line
+     */
+    virtual void write( const lineSegments& line );
+
+    /// Log record was written to appender.
+    /**
+     * @param[in] record  log record
+     */
+    virtual void written( const logRecord& record );
+
+    /// Open the file.
+    /**
+     * Unlike open(), the appender must be locked and the flush thread is left alone.
+     *
+     * @return  @c true if opened successfully, @c false otherwise
+     */
+    bool openFile();
+
+    /// Write out buffer and close the file.
+    /**
+     * Unlike close(), the appender must be locked and the flush thread is left alone.
+     */
+    void closeFile();
+
+    /// Write out buffer.
+    /**
+     * The appender must be locked. It is unlocked while writing to the file, another thread
+     * arriving meanwhile adds its lines to the next batch.
+     */
+    void flush();
 
 private:
 
-    std::ofstream ofs_;
+    static const std::size_t MAX_SEALED = 4;
+
+    typedef std::vector<char> buffer_type;
+
+    /// Batch entry, a buffer of lines or text borrowed from the line being written.
+    struct chunk
+    {
+        buffer_type buffer;
+        std::string_view borrowed;
+
+        /// Retrieve text to write.
+        std::string_view view() const {return ( borrowed.data() ? borrowed : std::string_view( buffer.data(), buffer.size() ) );}
+    };
+
+    int fd_;
+    std::size_t pos_;
+
+    buffer_type buffer_;
+    std::vector<chunk> sealed_;
+    std::vector<chunk> batch_;
+    std::vector<buffer_type> spare_;
+    std::size_t capacity_;
+
+    std::uint64_t appended_;
+    std::uint64_t durable_;
+    std::uint64_t opened_;
+    bool writing_;
+
+    logLevel::type immediateFlushLevel_;
+
+    std::condition_variable_any written_;
+
+    std::condition_variable_any wake_;
+    std::thread flusher_;
+    bool idle_;
+    bool stop_;
+
+    // ========================================================================
+
+    /// Seal or write out buffer if full.
+    void bufferFull();
+
+    /// Wake flusher waiting for lines.
+    void wakeFlusher();
+
+    /// Start new buffer, keeping the current one for the next batch.
+    void seal();
+
+    /// Write out buffered lines up to @p target bytes appended.
+    void commit( std::uint64_t target );
+
+    /// Write batch to file.
+    void writeFile( std::vector<chunk>& batch );
+
+    /// Write out buffer periodically.
+    void run( std::chrono::milliseconds interval );
 
 };
 
@@ -34,7 +34,8 @@ namespace clio
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 rollingFileAppender::rollingFileAppender() :
-    _Mybase()
+    _Mybase(),
+    rolling_( false )
 {
 }
 
@@ -68,13 +69,37 @@ void rollingFileAppender::setMaximumFileSize( std::size_t value )
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
-void rollingFileAppender::write( const std::string& line )
+void rollingFileAppender::write( std::string_view line )
 {
+    rollIfNeeded();
+
+    _Mybase::write( line );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void rollingFileAppender::write( const lineSegments& line )
+{
+    rollIfNeeded();
+
+    _Mybase::write( line );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void rollingFileAppender::rollIfNeeded()
+{
+    // closing the old log lets go of the lock, lines written meanwhile wait for the new log
+    while ( rolling_ )
+        rolled_.wait( m_ );
+
     // check if should roll
     if ( shouldRollLogs() )
+    {
+        rolling_ = true;
         rollLogs();
+        rolling_ = false;
 
-    _Mybase::write( line );
+        rolled_.notify_all();
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -89,7 +114,7 @@ bool rollingFileAppender::shouldRollLogs() const
 void rollingFileAppender::rollLogs()
 {
     // close log
-    close();
+    closeFile();
 
     // retrieve filename and number of copies to keep
     std::string filename( file() );
@@ -121,7 +146,7 @@ void rollingFileAppender::rollLogs()
     }
 
     // open log
-    open();
+    openFile();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
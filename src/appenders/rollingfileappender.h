@@ -27,6 +27,8 @@
 
 #include "fileappender.h"
 
+#include <condition_variable>
+
 /// Clio namespace.
 namespace clio
 {
@@ -48,6 +50,9 @@ class rollingFileAppender : public fileAppender
 
 public:
 
+    /// Appender type, as named in config files.
+    static constexpr const char *TYPE = "rollingFileAppender";
+
     /// How many rolled backups to keep.
     static constexpr const char *PROP_MAXSIZEROLLBACKUPS = "maxSizeRollBackups";
 
@@ -102,10 +107,24 @@ protected:
     /**
      * @param[in] line  log line
      */
-    virtual void write( const std::string& line );
+    virtual void write( std::string_view line );
+
+    /// Write line made of pieces to appender.
+    /**
+     * @param[in] line  log line
+     */
+    virtual void write( const lineSegments& line );
 
 private:
 
+    bool rolling_;
+    std::condition_variable_any rolled_;            ///< Signaled when done rolling.
+
+    // ========================================================================
+
+    /// Roll logs over if needed.
+    void rollIfNeeded();
+
     /// Check if we need to roll logs.
     bool shouldRollLogs() const;
 
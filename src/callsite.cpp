@@ -0,0 +1,114 @@
+/**
+ * @file callsite.cpp
+ * @brief Log statement call site class.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "callsite.h"
+#include "loggermanager.h"
+
+#include <list>
+
+/// Clio namespace.
+namespace clio
+{
+
+std::atomic<unsigned int> callSite::currentGeneration_( 1 );
+std::mutex callSite::resolveMutex_;
+
+std::atomic<const callSite*> callSite::first_( nullptr );
+
+/// Storage for logger names of registered call sites.
+static std::list<std::string> loggerNames;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+std::string callSite::buildLoggerName( std::string_view moduleName, std::string_view className, std::string_view classFunction )
+{
+    // generate name from properties
+    std::string name;
+
+    if ( !moduleName.empty() )
+    {
+        name.append( moduleName );
+        name.push_back( '.' );
+    }
+
+    if ( !className.empty() )
+    {
+        name.append( className );
+        name.push_back( '.' );
+    }
+
+    name.append( classFunction );
+
+    return name;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+logger *callSite::resolveImpl()
+{
+    std::lock_guard<std::mutex> guard( resolveMutex_ );
+
+    // another thread may have beat us to it
+    const unsigned int current( currentGeneration_.load( std::memory_order_acquire ) );
+
+    if ( current != generation_.load( std::memory_order_relaxed ) )
+    {
+        if ( !id_ )
+            registerSite();
+
+        // retrieve logger from manager
+        // loggers are freed only after call sites are invalidated and log statements using them
+        // are done, so holding on to the raw pointer is safe
+        logger_.store( loggerManager::current()->lookup( std::string( loggerName_ ) ), std::memory_order_relaxed );
+        generation_.store( current, std::memory_order_release );
+    }
+
+    return logger_.load( std::memory_order_relaxed );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void callSite::registerSite()
+{
+    static unsigned int lastId( 0 );
+
+    loggerNames.push_back( buildLoggerName( moduleName(), className(), classFunction() ) );
+
+    id_ = ++lastId;
+    loggerName_ = loggerNames.back();
+
+    // add to front of list
+    next_ = first_.load( std::memory_order_relaxed );
+    first_.store( this, std::memory_order_release );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void callSite::invalidate()
+{
+    currentGeneration_.fetch_add( 1, std::memory_order_acq_rel );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace clio
@@ -0,0 +1,239 @@
+/**
+ * @file callsite.h
+ * @brief Log statement call site class.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CALLSITE_H
+#define CALLSITE_H
+
+#include "clioapi.h"
+#include "functionname.h"
+#include "logger.h"
+#include "loglevel.h"
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+#if _WIN32
+#pragma warning( push )
+#pragma warning( disable: 4251 ) // disable warnings about STL interfaces
+#endif
+
+/// Clio namespace.
+namespace clio
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Log statement call site class.
+/**
+ * Each LOG_* macro expansion owns one static call site describing the statement: level, source
+ * file, line and function names. Log lines refer to their call site rather than copying this
+ * information.
+ *
+ * The call site also remembers which logger its log lines go to, so the lookup in
+ * @c loggerManager only happens the first time a statement runs after each configuration change.
+ * The first lookup registers the call site, after which it can be found by walking the list
+ * starting at first().
+ */
+class CLIO_API callSite
+{
+    friend class loggerManager;
+
+    typedef callSite _Myt;
+
+public:
+
+    // ========================================================================
+    // CTOR
+    // ========================================================================
+
+    /// Constructor.
+    /**
+     * @param[in] level  log line level
+     * @param[in] file  source file name (use the __FILE__ macro)
+     * @param[in] function  source function name (parsed from the __PRETTY_FUNCTION__ macro)
+     * @param[in] line  source file line (use the __LINE__ macro)
+     */
+    constexpr callSite( logLevel::type level, const char *file, const functionName& function, unsigned int line ) :
+        level_( level ),
+        file_( file ),
+        function_( function ),
+        line_( line ),
+        id_( 0 ),
+        loggerName_(),
+        next_( nullptr ),
+        generation_( 0 ),
+        logger_( nullptr )
+    {
+    }
+
+    // ========================================================================
+    // Properties
+    // ========================================================================
+
+    /// Retrieve log level.
+    /**
+     * @return  log level
+     */
+    logLevel::type level() const {return level_;}
+
+    /// Retrieve source filename.
+    /**
+     * @return  source file name
+     */
+    const char *sourceFilename() const {return file_;}
+
+    /// Retrieve module name.
+    /**
+     * @return  module/library name
+     */
+    std::string_view moduleName() const {return function_.moduleName();}
+
+    /// Retrieve class name.
+    /**
+     * @return  source file class name
+     */
+    std::string_view className() const {return function_.className();}
+
+    /// Retrieve class function.
+    /**
+     * @return  source file class function name
+     */
+    std::string_view classFunction() const {return function_.classFunction();}
+
+    /// Retrieve source file line number.
+    /**
+     * @return  source file line
+     */
+    unsigned int sourceLine() const {return line_;}
+
+    /// Retrieve call site id.
+    /**
+     * Call sites are numbered in the order they register.
+     * @return  call site id, or zero if not registered
+     */
+    unsigned int id() const {return id_;}
+
+    /// Retrieve logger name.
+    /**
+     * @return  logger name, or empty if not registered
+     */
+    std::string_view loggerName() const {return loggerName_;}
+
+    /// Retrieve next registered call site.
+    /**
+     * @return  pointer to call site, or @c nullptr if last
+     */
+    const callSite *next() const {return next_;}
+
+    /// Retrieve logger for this call site.
+    /**
+     * @return  pointer to logger, or @c nullptr if none
+     */
+    logger *resolve()
+    {
+        if ( currentGeneration_.load( std::memory_order_relaxed ) == generation_.load( std::memory_order_acquire ) )
+            return logger_.load( std::memory_order_relaxed );
+
+        return resolveImpl();
+    }
+
+    /// Check if log enabled.
+    /**
+     * @return  @c true if enabled, @c false otherwise
+     */
+    bool enabled()
+    {
+        const logger *l( resolve() );
+        return (( l ) && ( l->enabled( level_ ) ));
+    }
+
+    // ========================================================================
+    // Static Methods
+    // ========================================================================
+
+    /// Retrieve first registered call site.
+    /**
+     * @return  pointer to call site, or @c nullptr if none registered
+     */
+    static const callSite *first() {return first_.load( std::memory_order_acquire );}
+
+    /// Build logger name from module, class and function names.
+    /**
+     * @param[in] moduleName  module/library name
+     * @param[in] className  class name
+     * @param[in] classFunction  class function name
+     * @return  logger name
+     */
+    static std::string buildLoggerName( std::string_view moduleName, std::string_view className, std::string_view classFunction );
+
+private:
+
+    const logLevel::type level_;
+
+    const char *file_;
+    const functionName function_;
+    const unsigned int line_;
+
+    unsigned int id_;
+    std::string_view loggerName_;
+    const callSite *next_;
+
+    std::atomic<unsigned int> generation_;
+    std::atomic<logger*> logger_;
+
+    static std::atomic<unsigned int> currentGeneration_;
+    static std::mutex resolveMutex_;
+
+    static std::atomic<const callSite*> first_;
+
+    // ========================================================================
+
+    /// Lookup logger for this call site.
+    logger *resolveImpl();
+
+    /// Add call site to registry.
+    void registerSite();
+
+    /// Invalidate loggers of all call sites.
+    static void invalidate();
+
+    // not implemented
+    callSite( const _Myt& ) = delete;
+
+    // not implemented
+    _Myt& operator = ( const _Myt& ) = delete;
+
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace clio
+
+#if _WIN32
+#pragma warning( pop )
+#endif
+
+#endif // CALLSITE_H
@@ -39,6 +39,12 @@ bool CLIO_API clioInit( const std::string& filename )
     return clio::loggerManager::instance()->configure( filename );
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool CLIO_API clioInit( const clio::configBuilder& config )
+{
+    return config.apply();
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 unsigned int CLIO_API clioGetRefeshInterval()
 {
@@ -60,8 +66,35 @@ std::string CLIO_API clioGetVersion()
     return std::string( PACKAGE_VERSION );
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool CLIO_API clioGetDeferred()
+{
+    return clio::deferredWriter::active();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void CLIO_API clioSetDeferred( bool enabled )
+{
+    if ( enabled )
+        clio::deferredWriter::start();
+    else
+        clio::deferredWriter::stop();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void CLIO_API clioGetLookupStats( std::uint64_t& hits, std::uint64_t& misses )
+{
+    const clio::loggerManagerPtr manager( clio::loggerManager::instance() );
+
+    hits = manager->cacheHits();
+    misses = manager->cacheMisses();
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 void CLIO_API clioFinalize()
 {
-    return clio::loggerManager::instance()->terminate();
+    // write out deferred records while loggers are still around
+    clio::deferredWriter::stop();
+
+    clio::loggerManager::terminate();
 }
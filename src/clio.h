@@ -26,9 +26,15 @@
 #define CLIO_H
 
 #include "clioapi.h"
+#include "configbuilder.h"
+#include "deferredwriter.h"
+#include "epoch.h"
+#include "formatstring.h"
 #include "hexdump.h"
 #include "logline.h"
+#include "logrecord.h"
 
+#include <cstdint>
 #include <string>
 
 #if _WIN32
@@ -45,6 +51,14 @@
  */
 bool CLIO_API clioInit( const std::string& filename );
 
+/// Initialize clio library without a config file.
+/**
+ * This method may be called multiple times in order to reload configuration.
+ * @param[in] config  configuration description, see @c clio::configBuilder
+ * @return  @c true on success, @c false otherwise
+ */
+bool CLIO_API clioInit( const clio::configBuilder& config );
+
 /// Retrieve refresh interval.
 /**
  * Retrieve interval between configuration refreshes. The clio library will periodically check the
@@ -56,7 +70,8 @@ unsigned int CLIO_API clioGetRefeshInterval();
 /// Set refresh interval.
 /**
  * Set interval between configuration refreshes. The clio library will periodically check the
- * configuration file for changes and reload when this file changes.
+ * configuration file for changes and reload when this file changes. Not used where the file can
+ * be watched for changes instead (inotify on Linux).
  * @param[in] interval_ms  interval period in milliseconds
  */
 void CLIO_API clioSetRefeshInterval( unsigned int interval_ms );
@@ -67,6 +82,29 @@ void CLIO_API clioSetRefeshInterval( unsigned int interval_ms );
  */
 std::string CLIO_API clioGetVersion();
 
+/// Retrieve deferred writing.
+/**
+ * @return  @c true if LOG_*_F statements are formatted on a background thread, @c false otherwise
+ */
+bool CLIO_API clioGetDeferred();
+
+/// Set deferred writing.
+/**
+ * When on, LOG_*_F statements only capture their arguments and a background thread formats and
+ * writes them. Turning it off writes out everything captured so far.
+ * @param[in] enabled  @c true to defer LOG_*_F statements, @c false to write them right away
+ */
+void CLIO_API clioSetDeferred( bool enabled );
+
+/// Retrieve logger lookup cache counters.
+/**
+ * The logger found for a name is cached until the configuration changes, which mostly helps
+ * @c clio::logLine objects built outside the LOG_* macros.
+ * @param[out] hits  lookups answered from the cache
+ * @param[out] misses  lookups matched against logger names
+ */
+void CLIO_API clioGetLookupStats( std::uint64_t& hits, std::uint64_t& misses );
+
 /// Finalize clio library.
 void CLIO_API clioFinalize();
 
@@ -100,6 +138,47 @@ void CLIO_API clioFinalize();
 #define CLIO_FINALIZE \
     clioFinalize();
 
+/// Open log statement for call site at level.
+/**
+ * Expands to the head of a statement whose body only runs when the logger of this call site is
+ * enabled for @p LEVEL. The function name is parsed at compile time and the logger is looked up
+ * once per configuration and cached in the static call site @c clio_site_. The statement runs
+ * within an epoch guard, so the logger is not freed by a configuration change before the record
+ * is written.
+ */
+#define CLIO_LOG_SITE( LEVEL ) \
+    for ( bool clio_enabled_ = clio::logRecord::mayBeEnabled( LEVEL ); clio_enabled_; clio_enabled_ = false ) \
+        for ( static constexpr clio::functionName clio_function_( __PRETTY_FUNCTION__ ); clio_enabled_; clio_enabled_ = false ) \
+            for ( clio::epoch::guard clio_guard_; clio_enabled_; clio_enabled_ = false ) \
+            for ( static clio::callSite clio_site_( LEVEL, __FILE__, clio_function_, __LINE__ ); clio_enabled_ && clio_site_.enabled(); clio_enabled_ = false )
+
+/// Log message at level.
+/**
+ * Expands to a statement that only constructs the log record when the logger of this call site is
+ * enabled for @p LEVEL. Otherwise nothing is built and any values streamed into it are never
+ * evaluated.
+ * @code
+ * CLIO_LOG_LINE( clio::logLevel::Info ) << "this is informational";
+ * @endcode
+ */
+#define CLIO_LOG_LINE( LEVEL ) \
+    CLIO_LOG_SITE( LEVEL ) \
+        clio::logRecord( clio_site_ )
+
+/// Log formatted message at level.
+/**
+ * The format string is checked against the arguments at compile time, see @c clio::formatString.
+ * As with CLIO_LOG_LINE() the arguments are not evaluated when the log level is disabled. When
+ * deferred writing is on the record may be formatted later, see @c clio::deferredWriter.
+ * @code
+ * CLIO_LOG_FORMAT( clio::logLevel::Info, "order {} filled at {:.4f}", id, px );
+ * @endcode
+ */
+#define CLIO_LOG_FORMAT( LEVEL, FORMAT, ... ) \
+    CLIO_LOG_SITE( LEVEL ) \
+        for ( static constexpr decltype( clio::formatArgs( __VA_ARGS__ ) ) clio_format_( FORMAT ); clio_enabled_; clio_enabled_ = false ) \
+            clio::deferredWriter::write( clio_site_, clio_format_, ##__VA_ARGS__ )
+
 /// Log fatal message.
 /**
  * @code
@@ -107,7 +186,7 @@ void CLIO_API clioFinalize();
  * @endcode
  */
 #define LOG_FATAL \
-    clio::logLine( clio::logLevel::Fatal, __FILE__, __PRETTY_FUNCTION__, __LINE__ )
+    CLIO_LOG_LINE( clio::logLevel::Fatal )
 
 /// Log error message.
 /**
@@ -116,7 +195,7 @@ void CLIO_API clioFinalize();
  * @endcode
  */
 #define LOG_ERROR \
-    clio::logLine( clio::logLevel::Error, __FILE__, __PRETTY_FUNCTION__, __LINE__ )
+    CLIO_LOG_LINE( clio::logLevel::Error )
 
 /// Log warning message.
 /**
@@ -125,7 +204,7 @@ void CLIO_API clioFinalize();
  * @endcode
  */
 #define LOG_WARN \
-    clio::logLine( clio::logLevel::Warning, __FILE__, __PRETTY_FUNCTION__, __LINE__ )
+    CLIO_LOG_LINE( clio::logLevel::Warning )
 
 /// Log informational message.
 /**
@@ -134,7 +213,7 @@ void CLIO_API clioFinalize();
  * @endcode
  */
 #define LOG_INFO \
-    clio::logLine( clio::logLevel::Info, __FILE__, __PRETTY_FUNCTION__, __LINE__ )
+    CLIO_LOG_LINE( clio::logLevel::Info )
 
 /// Log debug message.
 /**
@@ -143,7 +222,7 @@ void CLIO_API clioFinalize();
  * @endcode
  */
 #define LOG_DEBUG \
-    clio::logLine( clio::logLevel::Debug, __FILE__, __PRETTY_FUNCTION__, __LINE__ )
+    CLIO_LOG_LINE( clio::logLevel::Debug )
 
 /// Log trace message.
 /**
@@ -152,7 +231,63 @@ void CLIO_API clioFinalize();
  * @endcode
  */
 #define LOG_TRACE \
-    clio::logLine( clio::logLevel::Trace, __FILE__, __PRETTY_FUNCTION__, __LINE__ )
+    CLIO_LOG_LINE( clio::logLevel::Trace )
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Log formatted fatal message.
+/**
+ * @code
+ * LOG_FATAL_F( "order {} rejected: {}", id, reason );
+ * @endcode
+ */
+#define LOG_FATAL_F( FORMAT, ... ) \
+    CLIO_LOG_FORMAT( clio::logLevel::Fatal, FORMAT, ##__VA_ARGS__ )
+
+/// Log formatted error message.
+/**
+ * @code
+ * LOG_ERROR_F( "order {} rejected: {}", id, reason );
+ * @endcode
+ */
+#define LOG_ERROR_F( FORMAT, ... ) \
+    CLIO_LOG_FORMAT( clio::logLevel::Error, FORMAT, ##__VA_ARGS__ )
+
+/// Log formatted warning message.
+/**
+ * @code
+ * LOG_WARN_F( "queue at {}% of capacity", pct );
+ * @endcode
+ */
+#define LOG_WARN_F( FORMAT, ... ) \
+    CLIO_LOG_FORMAT( clio::logLevel::Warning, FORMAT, ##__VA_ARGS__ )
+
+/// Log formatted informational message.
+/**
+ * @code
+ * LOG_INFO_F( "order {} filled at {:.4f}", id, px );
+ * @endcode
+ */
+#define LOG_INFO_F( FORMAT, ... ) \
+    CLIO_LOG_FORMAT( clio::logLevel::Info, FORMAT, ##__VA_ARGS__ )
+
+/// Log formatted debug message.
+/**
+ * @code
+ * LOG_DEBUG_F( "state {:>8} -> {:<8}", from, to );
+ * @endcode
+ */
+#define LOG_DEBUG_F( FORMAT, ... ) \
+    CLIO_LOG_FORMAT( clio::logLevel::Debug, FORMAT, ##__VA_ARGS__ )
+
+/// Log formatted trace message.
+/**
+ * @code
+ * LOG_TRACE_F( "received {} bytes (0x{:04X})", len, len );
+ * @endcode
+ */
+#define LOG_TRACE_F( FORMAT, ... ) \
+    CLIO_LOG_FORMAT( clio::logLevel::Trace, FORMAT, ##__VA_ARGS__ )
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -0,0 +1,167 @@
+/**
+ * @file configbuilder.cpp
+ * @brief Configuration builder class.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "configbuilder.h"
+#include "loggermanager.h"
+
+/// Clio namespace.
+namespace clio
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+configBuilder::configBuilder() :
+    appender_( NONE ),
+    child_( NONE )
+{
+    doc_.name = "logging";
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+configBuilder& configBuilder::ref( const std::string& name )
+{
+    if ( NONE != appender_ )
+        doc_.children[appender_].children.push_back( element{"appender-ref", name, {}, {}} );
+
+    return *this;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+configBuilder& configBuilder::set( const std::string& prop, const std::string& value )
+{
+    element *e( current() );
+
+    if ( e )
+        e->children.push_back( element{prop, value, {}, {}} );
+
+    return *this;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+configBuilder& configBuilder::logger( const std::string& name, logLevel::type level, std::initializer_list<std::string> appenders )
+{
+    element e( loggerElement( level, appenders ) );
+    e.attributes.push_back( std::make_pair( std::string( "name" ), name ) );
+
+    doc_.children.push_back( std::move( e ) );
+
+    // properties no longer go to last appender
+    appender_ = child_ = NONE;
+
+    return *this;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+configBuilder& configBuilder::root( logLevel::type level, std::initializer_list<std::string> appenders )
+{
+    element e( loggerElement( level, appenders ) );
+    e.name = "root";
+
+    // only one root logger, the last one set wins
+    bool found( false );
+
+    for ( element& i: doc_.children )
+    {
+        if ( "root" == i.name )
+        {
+            i = std::move( e );
+            found = true;
+            break;
+        }
+    }
+
+    if ( !found )
+        doc_.children.push_back( std::move( e ) );
+
+    appender_ = child_ = NONE;
+
+    return *this;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool configBuilder::apply() const
+{
+    return loggerManager::instance()->configure( *this );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+configBuilder& configBuilder::add( const std::string& name, const char *type )
+{
+    element e{"appender", std::string(), {}, {}};
+    e.attributes.push_back( std::make_pair( std::string( "name" ), name ) );
+    e.attributes.push_back( std::make_pair( std::string( "type" ), std::string( type ) ) );
+
+    appender_ = doc_.children.size();
+    child_ = NONE;
+
+    doc_.children.push_back( std::move( e ) );
+
+    return *this;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+configBuilder& configBuilder::addTo( const char *name, const char *type )
+{
+    if ( NONE == appender_ )
+        return *this;
+
+    element e{name, std::string(), {}, {}};
+    e.attributes.push_back( std::make_pair( std::string( "type" ), std::string( type ) ) );
+
+    std::vector<element>& children( doc_.children[appender_].children );
+
+    child_ = children.size();
+    children.push_back( std::move( e ) );
+
+    return *this;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+configBuilder::element *configBuilder::current()
+{
+    if ( NONE == appender_ )
+        return nullptr;
+
+    element& app( doc_.children[appender_] );
+
+    return ( NONE == child_ ) ? &app : &app.children[child_];
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+configBuilder::element configBuilder::loggerElement( logLevel::type level, std::initializer_list<std::string> appenders )
+{
+    element e{"logger", std::string(), {}, {}};
+    e.children.push_back( element{"level", logLevel::toString( level ), {}, {}} );
+
+    for ( const std::string& name: appenders )
+        e.children.push_back( element{"appender-ref", name, {}, {}} );
+
+    return e;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace clio
@@ -0,0 +1,253 @@
+/**
+ * @file configbuilder.h
+ * @brief Configuration builder class.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CONFIGBUILDER_H
+#define CONFIGBUILDER_H
+
+#include "clioapi.h"
+#include "loglevel.h"
+
+#include <chrono>
+#include <cstddef>
+#include <initializer_list>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// Clio namespace.
+namespace clio
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Configuration builder class.
+/**
+ * Describes appenders and loggers in code, the way a config file does but without one:
+ * @code
+ * clio::config()
+ *     .appender<clio::fileAppender>( "main" )
+ *         .set( clio::fileAppender::PROP_FILE, "myapp.log" )
+ *         .layout<clio::patternLayout>( "%date %level %message%newline" )
+ *     .logger( "net.*", clio::logLevel::Debug, {"main"} )
+ *     .root( clio::logLevel::Info, {"main"} )
+ *     .apply();
+ * @endcode
+ *
+ * Properties set with set() go to the appender, layout or filter added last, using the names and
+ * values documented for config files. Applying loads the description with the same code as a
+ * config file and replaces the current configuration in one step, keeping appenders and loggers
+ * that did not change. No file is read and the configuration is not monitored for changes.
+ */
+class CLIO_API configBuilder
+{
+    typedef configBuilder _Myt;
+
+public:
+
+    /// Element of description, as it would appear in a config file.
+    struct element
+    {
+        std::string name;                           ///< element name
+        std::string text;                           ///< element text
+        std::vector<std::pair<std::string, std::string>> attributes;   ///< attributes
+        std::vector<element> children;              ///< child elements
+    };
+
+    // ========================================================================
+    // CTOR / DTOR
+    // ========================================================================
+
+    /// Constructor.
+    configBuilder();
+
+    // ========================================================================
+    // Properties
+    // ========================================================================
+
+    /// Retrieve description.
+    /**
+     * @return  logging element with appenders and loggers as children
+     */
+    const element& document() const {return doc_;}
+
+    // ========================================================================
+    // Methods
+    // ========================================================================
+
+    /// Add appender.
+    /**
+     * Appenders may only refer to appenders added before them.
+     * @param[in] name  appender name
+     * @return  reference to this object
+     */
+    template <class T>
+    _Myt& appender( const std::string& name ) {return add( name, T::TYPE );}
+
+    /// Set layout of appender added last.
+    /**
+     * @return  reference to this object
+     */
+    template <class T>
+    _Myt& layout() {return addTo( "layout", T::TYPE );}
+
+    /// Set layout of appender added last.
+    /**
+     * @param[in] pattern  conversion pattern of layout
+     * @return  reference to this object
+     */
+    template <class T>
+    _Myt& layout( const std::string& pattern ) {return layout<T>().set( T::PROP_CONVERSIONPATTERN, pattern );}
+
+    /// Add filter to appender added last.
+    /**
+     * @return  reference to this object
+     */
+    template <class T>
+    _Myt& filter() {return addTo( "filter", T::TYPE );}
+
+    /// Make appender added last pass records on to another appender.
+    /**
+     * @param[in] name  name of appender added before
+     * @return  reference to this object
+     */
+    _Myt& ref( const std::string& name );
+
+    /// Set property of appender, layout or filter added last.
+    /**
+     * @param[in] prop  property name
+     * @param[in] value  property value
+     * @return  reference to this object
+     */
+    _Myt& set( const std::string& prop, const std::string& value );
+
+    /// Set property of appender, layout or filter added last.
+    /**
+     * @param[in] prop  property name
+     * @param[in] value  property value
+     * @return  reference to this object
+     */
+    _Myt& set( const std::string& prop, const char *value ) {return set( prop, std::string( value ) );}
+
+    /// Set property of appender, layout or filter added last.
+    /**
+     * @param[in] prop  property name
+     * @param[in] value  property value
+     * @return  reference to this object
+     */
+    _Myt& set( const std::string& prop, bool value ) {return set( prop, std::string( value ? "true" : "false" ) );}
+
+    /// Set property of appender, layout or filter added last.
+    /**
+     * @param[in] prop  property name
+     * @param[in] value  property value
+     * @return  reference to this object
+     */
+    _Myt& set( const std::string& prop, logLevel::type value ) {return set( prop, logLevel::toString( value ) );}
+
+    /// Set numeric property of appender, layout or filter added last.
+    /**
+     * @param[in] prop  property name
+     * @param[in] value  property value
+     * @return  reference to this object
+     */
+    template <class T, class = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+    _Myt& set( const std::string& prop, T value ) {return set( prop, std::to_string( value ) );}
+
+    /// Set duration property of appender, layout or filter added last.
+    /**
+     * @param[in] prop  property name
+     * @param[in] value  property value, in milliseconds as in config files
+     * @return  reference to this object
+     */
+    template <class Rep, class Period>
+    _Myt& set( const std::string& prop, const std::chrono::duration<Rep, Period>& value );
+
+    /// Add logger.
+    /**
+     * @param[in] name  logger name, may have '*' and '?' wildcards
+     * @param[in] level  logger level
+     * @param[in] appenders  names of appenders to write to
+     * @return  reference to this object
+     */
+    _Myt& logger( const std::string& name, logLevel::type level, std::initializer_list<std::string> appenders = {} );
+
+    /// Set root logger.
+    /**
+     * @param[in] level  logger level
+     * @param[in] appenders  names of appenders to write to
+     * @return  reference to this object
+     */
+    _Myt& root( logLevel::type level, std::initializer_list<std::string> appenders = {} );
+
+    /// Replace current configuration.
+    /**
+     * @return  @c true on success, @c false otherwise
+     */
+    bool apply() const;
+
+private:
+
+    static const std::size_t NONE = ~std::size_t( 0 );
+
+    element doc_;
+
+    std::size_t appender_;                          ///< appender added last
+    std::size_t child_;                             ///< its layout or filter added last
+
+    // ========================================================================
+
+    /// Add appender.
+    _Myt& add( const std::string& name, const char *type );
+
+    /// Add layout or filter to appender added last.
+    _Myt& addTo( const char *name, const char *type );
+
+    /// Retrieve element set() goes to.
+    element *current();
+
+    /// Add logger element.
+    static element loggerElement( logLevel::type level, std::initializer_list<std::string> appenders );
+
+};
+
+template <class Rep, class Period>
+configBuilder& configBuilder::set( const std::string& prop, const std::chrono::duration<Rep, Period>& value )
+{
+    return set( prop, std::to_string( std::chrono::duration_cast<std::chrono::milliseconds>( value ).count() ) );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Start describing configuration.
+/**
+ * @return  empty builder
+ */
+inline configBuilder config() {return configBuilder();}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace clio
+
+#endif // CONFIGBUILDER_H
@@ -0,0 +1,477 @@
+/**
+ * @file deferredwriter.cpp
+ * @brief Deferred log writer class.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "deferredwriter.h"
+#include "epoch.h"
+#include "logger.h"
+
+#include <condition_variable>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// Clio namespace.
+namespace clio
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Buffer of captured records for one thread.
+/**
+ * Single producer, single consumer ring of entries. Entries never wrap around the end of the
+ * buffer, a padding entry fills the space left at the end instead.
+ */
+class deferredWriter::threadBuffer
+{
+public:
+
+    /// Constructor.
+    explicit threadBuffer( std::size_t capacity ) :
+        data_( new char[capacity] ),
+        capacity_( capacity ),
+        threadId_( logRecord::currentThreadId() ),
+        head_( 0 ),
+        tail_( 0 ),
+        pendingTail_( 0 ),
+        wake_( false ),
+        busy_( false ),
+        abandoned_( false )
+    {
+    }
+
+    /// Destructor.
+    ~threadBuffer() {delete [] data_;}
+
+    /// Retrieve id of owning thread.
+    std::size_t threadId() const {return threadId_;}
+
+    /// Check if owning thread is writing an entry.
+    bool busy() const {return busy_.load();}
+
+    /// Check if owning thread has exited.
+    bool abandoned() const {return abandoned_.load( std::memory_order_acquire );}
+
+    /// Mark owning thread as exited.
+    void abandon() {abandoned_.store( true, std::memory_order_release );}
+
+    /// Check if all entries were released.
+    bool empty() const {return ( head_.load( std::memory_order_acquire ) == tail_.load( std::memory_order_acquire ));}
+
+    /// Reserve space for entry.
+    /**
+     * @param[in] len  entry size
+     * @param[in] wait  wait for room when full, otherwise give up
+     * @return  pointer to entry, or @c nullptr if not active, too big or full
+     */
+    char *begin( std::size_t len, bool wait )
+    {
+        len = (len + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+
+        // too big, log synchronously
+        if ( capacity_ / 2 < len )
+            return nullptr;
+
+        // flag must be visible before we check for active, see deferredWriter::stop()
+        busy_.store( true );
+
+        if ( !deferredWriter::active_.load() )
+        {
+            busy_.store( false, std::memory_order_release );
+            return nullptr;
+        }
+
+        // consumer about to sleep either sees us busy or gets woken, see deferredWriter::run()
+        wake_ = deferredWriter::idle_.load();
+
+        const std::size_t tail( tail_.load( std::memory_order_relaxed ) );
+        const std::size_t pos( tail % capacity_ );
+
+        // skip end of buffer if entry does not fit
+        const std::size_t padding(( capacity_ - pos < len ) ? capacity_ - pos : 0 );
+
+        // wait for room
+        while ( capacity_ < tail - head_.load( std::memory_order_acquire ) + padding + len )
+        {
+            if ( !wait )
+            {
+                busy_.store( false, std::memory_order_release );
+                return nullptr;
+            }
+
+            std::this_thread::yield();
+        }
+
+        // consumer skips space too small for a header by itself
+        if ( sizeof(entry) <= padding )
+        {
+            entry *e( reinterpret_cast<entry*>( data_ + pos ) );
+            e->size = (std::uint32_t) padding;
+            e->format = nullptr;
+        }
+
+        char *result( data_ + (tail + padding) % capacity_ );
+        reinterpret_cast<entry*>( result )->size = (std::uint32_t) len;
+
+        pendingTail_ = tail + padding + len;
+
+        return result;
+    }
+
+    /// Publish entry.
+    /**
+     * @return  @c true if consumer needs waking, @c false otherwise
+     */
+    bool end()
+    {
+        tail_.store( pendingTail_, std::memory_order_release );
+        busy_.store( false, std::memory_order_release );
+
+        return wake_;
+    }
+
+    /// Retrieve oldest entry.
+    const entry *front()
+    {
+        const std::size_t tail( tail_.load( std::memory_order_acquire ) );
+        std::size_t head( head_.load( std::memory_order_relaxed ) );
+
+        while ( head != tail )
+        {
+            const std::size_t pos( head % capacity_ );
+
+            // skip padding at end of buffer
+            if ( capacity_ - pos < sizeof(entry) )
+                head += capacity_ - pos;
+            else
+            {
+                const entry *e( reinterpret_cast<const entry*>( data_ + pos ) );
+
+                if ( e->format )
+                    return e;
+
+                head += e->size;
+            }
+
+            head_.store( head, std::memory_order_release );
+        }
+
+        return nullptr;
+    }
+
+    /// Release oldest entry.
+    void pop( const entry *e )
+    {
+        head_.store( head_.load( std::memory_order_relaxed ) + e->size, std::memory_order_release );
+    }
+
+private:
+
+    static const std::size_t ALIGNMENT = alignof(entry);
+
+    char *data_;
+    const std::size_t capacity_;
+
+    const std::size_t threadId_;
+
+    std::atomic<std::size_t> head_;
+    std::atomic<std::size_t> tail_;
+    std::size_t pendingTail_;
+    bool wake_;
+
+    std::atomic<bool> busy_;
+    std::atomic<bool> abandoned_;
+
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Owner of thread buffers.
+struct deferredWriter::bufferRegistry
+{
+    std::mutex m;
+    std::list<std::unique_ptr<threadBuffer>> buffers;
+
+    std::condition_variable wakeup;
+    std::thread consumer;
+    bool stop = false;
+    bool woken = false;
+
+    /// Destructor.
+    ~bufferRegistry()
+    {
+        // deferredWriter::stop() was not called, at least do not leave a running thread behind
+        if ( consumer.joinable() )
+        {
+            {
+                std::lock_guard<std::mutex> guard( m );
+
+                stop = true;
+                wakeup.notify_all();
+            }
+
+            consumer.join();
+        }
+    }
+};
+
+/// Thread buffer of calling thread.
+struct deferredWriter::bufferHolder
+{
+    threadBuffer *buffer = nullptr;
+    bool consumer = false;
+
+    ~bufferHolder()
+    {
+        if ( buffer )
+            buffer->abandon();
+    }
+};
+
+std::atomic<bool> deferredWriter::active_( false );
+std::atomic<bool> deferredWriter::idle_( false );
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void deferredWriter::start()
+{
+    bufferRegistry& r( registry() );
+    std::lock_guard<std::mutex> guard( r.m );
+
+    if ( r.consumer.joinable() )
+        return;
+
+    r.stop = false;
+    r.consumer = std::thread( &deferredWriter::run );
+
+    active_.store( true );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void deferredWriter::stop()
+{
+    bufferRegistry& r( registry() );
+
+    {
+        std::lock_guard<std::mutex> guard( r.m );
+
+        if ( !r.consumer.joinable() )
+            return;
+
+        active_.store( false );
+    }
+
+    // let statements in progress finish, the consumer keeps making room for them
+    for ( ;; )
+    {
+        std::unique_lock<std::mutex> lock( r.m );
+
+        bool busy( false );
+
+        for ( const auto& i: r.buffers )
+            busy |= i->busy();
+
+        if ( !busy )
+        {
+            r.stop = true;
+            r.wakeup.notify_all();
+            break;
+        }
+
+        lock.unlock();
+        std::this_thread::yield();
+    }
+
+    r.consumer.join();
+    r.consumer = std::thread();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+char *deferredWriter::beginEntry( std::size_t len )
+{
+    bufferHolder& holder( localBuffer() );
+
+    if ( !holder.buffer )
+    {
+        bufferRegistry& r( registry() );
+        std::lock_guard<std::mutex> guard( r.m );
+
+        r.buffers.emplace_back( new threadBuffer( DEFAULT_BUFFER_SIZE ) );
+        holder.buffer = r.buffers.back().get();
+    }
+
+    // only the consumer makes room in its own buffer, it writes right away instead of waiting
+    return holder.buffer->begin( len, !holder.consumer );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void deferredWriter::endEntry()
+{
+    if ( localBuffer().buffer->end() )
+        wake();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void deferredWriter::wake()
+{
+    bufferRegistry& r( registry() );
+    std::lock_guard<std::mutex> guard( r.m );
+
+    r.woken = true;
+    r.wakeup.notify_one();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void deferredWriter::run()
+{
+    bufferRegistry& r( registry() );
+
+    // records logged while writing go to our own buffer
+    localBuffer().consumer = true;
+
+    for ( ;; )
+    {
+        if ( drain() )
+            continue;
+
+        std::unique_lock<std::mutex> lock( r.m );
+
+        // write out whatever is left before leaving
+        if ( r.stop )
+        {
+            lock.unlock();
+
+            while ( drain() )
+                ;
+
+            break;
+        }
+
+        // statements from now on wake us, unless they see us busy draining, see threadBuffer::begin()
+        idle_.store( true );
+
+        bool pending( false );
+
+        for ( const auto& i: r.buffers )
+            pending |= (( i->busy() ) || ( !i->empty() ));
+
+        // one caught in between, it will not wake us
+        if ( pending )
+        {
+            idle_.store( false, std::memory_order_relaxed );
+
+            lock.unlock();
+            std::this_thread::yield();
+            continue;
+        }
+
+        r.wakeup.wait( lock, [&r] {return (( r.stop ) || ( r.woken ));} );
+
+        r.woken = false;
+        idle_.store( false, std::memory_order_relaxed );
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool deferredWriter::drain()
+{
+    bufferRegistry& r( registry() );
+
+    std::unique_lock<std::mutex> lock( r.m );
+
+    // forget buffers of exited threads
+    r.buffers.remove_if( []( const std::unique_ptr<threadBuffer>& b ) {return (( b->abandoned() ) && ( !b->front() ));} );
+
+    // buffers registered later are picked up next time
+    std::vector<threadBuffer*> buffers;
+    buffers.reserve( r.buffers.size() );
+
+    for ( const auto& i: r.buffers )
+        buffers.push_back( i.get() );
+
+    lock.unlock();
+
+    bool written( false );
+
+    for ( ;; )
+    {
+        threadBuffer *oldest( nullptr );
+        const entry *e( nullptr );
+
+        // merge threads by time stamp
+        for ( threadBuffer *b: buffers )
+        {
+            const entry *temp( b->front() );
+
+            if (( temp ) && (( !e ) || ( temp->stamp < e->stamp )))
+            {
+                oldest = b;
+                e = temp;
+            }
+        }
+
+        if ( !e )
+            break;
+
+        // keep the logger from being freed by a configuration change until written
+        epoch::guard guard;
+
+        logger *l( e->site->resolve() );
+
+        if (( l ) && ( l->enabled( e->site->level() ) ))
+        {
+            logRecord record( *e->site, l, e->site->level() );
+            record.setTimeStamp( e->stamp );
+            record.setThreadId( oldest->threadId() );
+
+            e->format( e->descriptor, record.textBuffer(), reinterpret_cast<const char*>( e + 1 ) );
+        }
+
+        oldest->pop( e );
+        written = true;
+    }
+
+    return written;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+deferredWriter::bufferRegistry& deferredWriter::registry()
+{
+    static bufferRegistry r;
+    return r;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+deferredWriter::bufferHolder& deferredWriter::localBuffer()
+{
+    static thread_local bufferHolder holder;
+    return holder;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace clio
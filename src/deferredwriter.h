@@ -0,0 +1,305 @@
+/**
+ * @file deferredwriter.h
+ * @brief Deferred log writer class.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef DEFERREDWRITER_H
+#define DEFERREDWRITER_H
+
+#include "callsite.h"
+#include "clioapi.h"
+#include "formatstring.h"
+#include "logrecord.h"
+#include "textbuffer.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+#if _WIN32
+#pragma warning( push )
+#pragma warning( disable: 4251 ) // disable warnings about STL interfaces
+#endif
+
+/// Clio namespace.
+namespace clio
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Deferred argument encoding.
+/**
+ * Numbers, characters and booleans are copied as raw bytes.
+ */
+template <class T, bool IsString = ( formatStringBase::String == formatStringBase::kindOf<T>() )>
+struct deferredArg
+{
+    typedef T type;     ///< Decoded type.
+
+    /// Retrieve encoded size.
+    static std::size_t size( const T& ) {return sizeof(T);}
+
+    /// Encode value.
+    static void write( char *& p, const T& value )
+    {
+        std::memcpy( p, &value, sizeof(T) );
+        p += sizeof(T);
+    }
+
+    /// Decode value.
+    static type read( const char *& p )
+    {
+        type value;
+        std::memcpy( &value, p, sizeof(T) );
+        p += sizeof(T);
+        return value;
+    }
+};
+
+/// Deferred argument encoding for strings.
+/**
+ * Strings are copied as a length followed by the characters, and decode to a view into the
+ * deferred buffer.
+ */
+template <class T>
+struct deferredArg<T, true>
+{
+    typedef std::string_view type;  ///< Decoded type.
+
+    /// Retrieve encoded size.
+    static std::size_t size( const T& value ) {return sizeof(std::uint32_t) + view( value ).size();}
+
+    /// Encode value.
+    static void write( char *& p, const T& value )
+    {
+        const std::string_view v( view( value ) );
+        const std::uint32_t len( (std::uint32_t) v.size() );
+
+        std::memcpy( p, &len, sizeof(len) );
+        std::memcpy( p + sizeof(len), v.data(), len );
+        p += sizeof(len) + len;
+    }
+
+    /// Decode value.
+    static type read( const char *& p )
+    {
+        std::uint32_t len;
+        std::memcpy( &len, p, sizeof(len) );
+
+        const type value( p + sizeof(len), len );
+        p += sizeof(len) + len;
+        return value;
+    }
+
+private:
+
+    /// Retrieve string.
+    static std::string_view view( const T& value )
+    {
+        if constexpr (( std::is_same_v<T, const char*> ) || ( std::is_same_v<T, char*> ))
+            return ( value ? std::string_view( value ) : std::string_view() );
+        else
+            return std::string_view( value );
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Deferred log writer class.
+/**
+ * When started, LOG_*_F statements whose arguments are all numbers, characters, booleans or
+ * standard strings no longer format on the calling thread. Instead the statement copies a pointer to its
+ * static call site and format string plus the raw argument bytes into a buffer owned by the
+ * calling thread. A background thread later formats the text and runs the usual logger, layout and
+ * appender pipeline.
+ *
+ * Records from one thread are written in order. Records from different threads are merged by
+ * time stamp, but only among records already captured when the background thread looks.
+ * Statements that format on the calling thread (LOG_* with operator<<, or arguments of other
+ * types) are written right away, so they can appear ahead of deferred records logged before them.
+ *
+ * When a thread's buffer is full the statement waits for the background thread to make room. The
+ * background thread itself writes right away instead, as only it could make room.
+ */
+class CLIO_API deferredWriter
+{
+public:
+
+    /// Entry format function.
+    typedef void (*formatFunc)( const void *format, textBuffer& out, const char *args );
+
+    /// Entry header, followed by argument bytes.
+    struct entry
+    {
+        std::uint32_t size;                         ///< Entry size, including header.
+        formatFunc format;                          ///< Format function, @c nullptr for padding.
+        const void *descriptor;                     ///< Format string.
+        callSite *site;                             ///< Call site of log statement.
+        logRecord::clock_type::time_point stamp;    ///< Time stamp.
+    };
+
+    static const std::size_t DEFAULT_BUFFER_SIZE = 256 * 1024;  ///< Size of each thread buffer.
+
+    // ========================================================================
+    // Static Methods
+    // ========================================================================
+
+    /// Check if deferred writing is active.
+    /**
+     * @return  @c true if active, @c false otherwise
+     */
+    static bool active() {return active_.load( std::memory_order_relaxed );}
+
+    /// Start background thread and defer LOG_*_F statements.
+    static void start();
+
+    /// Stop deferring statements, write out all captured records and stop background thread.
+    static void stop();
+
+    /// Write formatted log record.
+    /**
+     * The record is captured for the background thread when active and the arguments allow it,
+     * otherwise it is formatted and written right away.
+     *
+     * @param[in] site  call site of log statement
+     * @param[in] format  format string
+     * @param[in] args  format arguments
+     */
+    template <class... Args, class... A>
+    static void write( callSite& site, const formatString<Args...>& format, const A&... args )
+    {
+        if constexpr ( deferrable<std::decay_t<const A&>...>() )
+        {
+            if (( active() ) && ( capture( site, format, args... ) ))
+                return;
+        }
+
+        format.append( logRecord( site ).textBuffer(), args... );
+    }
+
+private:
+
+    class threadBuffer;
+    struct bufferRegistry;
+    struct bufferHolder;
+
+    static std::atomic<bool> active_;
+    static std::atomic<bool> idle_;
+
+    // ========================================================================
+
+    /// Check if arguments of types @p T can be captured.
+    template <class... T>
+    static constexpr bool deferrable() {return ( deferrableArg<T>() && ... && true );}
+
+    /// Check if argument of type @p T can be captured.
+    /**
+     * Other types converting to strings may have formatters of their own, which only run on the
+     * calling thread.
+     */
+    template <class T>
+    static constexpr bool deferrableArg()
+    {
+        if constexpr ( formatStringBase::String == formatStringBase::kindOf<T>() )
+            return (( std::is_same_v<T, const char*> ) || ( std::is_same_v<T, char*> ) || ( std::is_same_v<T, std::string> ) || ( std::is_same_v<T, std::string_view> ));
+        else
+            return ( formatStringBase::Other != formatStringBase::kindOf<T>() );
+    }
+
+    /// Capture log record.
+    template <class... Args, class... A>
+    static bool capture( callSite& site, const formatString<Args...>& format, const A&... args )
+    {
+        const std::size_t len( sizeof(entry) + (deferredArg<std::decay_t<const A&>>::size( args ) + ... + 0) );
+
+        char *p( beginEntry( len ) );
+
+        if ( !p )
+            return false;
+
+        entry *e( reinterpret_cast<entry*>( p ) );
+        e->format = &formatEntry<formatString<Args...>, std::decay_t<const A&>...>;
+        e->descriptor = &format;
+        e->site = &site;
+        e->stamp = logRecord::clock_type::now();
+
+        p += sizeof(entry);
+        (deferredArg<std::decay_t<const A&>>::write( p, args ), ...);
+
+        endEntry();
+        return true;
+    }
+
+    /// Format captured log record.
+    template <class F, class... A>
+    static void formatEntry( const void *format, textBuffer& out, const char *args )
+    {
+        // braced initialization reads arguments in order
+        const std::tuple<typename deferredArg<A>::type...> values{deferredArg<A>::read( args )...};
+
+        std::apply( [format, &out]( const auto&... v ) {static_cast<const F*>( format )->append( out, v... );}, values );
+    }
+
+    /// Reserve space for entry in buffer of calling thread.
+    /**
+     * @param[in] len  entry size
+     * @return  pointer to entry, or @c nullptr if not active
+     */
+    static char *beginEntry( std::size_t len );
+
+    /// Publish entry in buffer of calling thread.
+    static void endEntry();
+
+    /// Wake background thread waiting for entries.
+    static void wake();
+
+    /// Retrieve thread buffer registry.
+    static bufferRegistry& registry();
+
+    /// Retrieve thread buffer of calling thread.
+    static bufferHolder& localBuffer();
+
+    /// Write captured records.
+    static void run();
+
+    /// Write all captured records.
+    /**
+     * @return  @c true if any written, @c false otherwise
+     */
+    static bool drain();
+
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace clio
+
+#if _WIN32
+#pragma warning( pop )
+#endif
+
+#endif // DEFERREDWRITER_H
@@ -0,0 +1,143 @@
+/**
+ * @file epoch.cpp
+ * @brief Epoch based reclamation of shared state.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "epoch.h"
+
+#include <thread>
+
+/// Clio namespace.
+namespace clio
+{
+
+std::atomic<std::uint64_t> epoch::current_( 1 );
+std::atomic<epoch::slot*> epoch::first_( nullptr );
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void epoch::enter()
+{
+    slot *s( local() );
+
+    if ( 0 == s->depth++ )
+    {
+        // release, a writer seeing us enter again must also see what we did before
+        s->entered.store( current_.load( std::memory_order_relaxed ), std::memory_order_release );
+
+        // announce before reading, pairs with the fence in synchronize()
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void epoch::leave()
+{
+    slot *s( local() );
+
+    if ( 0 == --s->depth )
+        s->entered.store( 0, std::memory_order_release );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void epoch::synchronize()
+{
+    // threads entering from now on announce a value we have not seen
+    current_.fetch_add( 1, std::memory_order_relaxed );
+
+    // state swapped in before this is what readers entering after it see
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+
+    const slot *self( local() );
+
+    for ( slot *s = first_.load( std::memory_order_acquire ); s; s = s->next )
+    {
+        if ( self == s )
+            continue;
+
+        const std::uint64_t entered( s->entered.load( std::memory_order_acquire ) );
+
+        if ( !entered )
+            continue;
+
+        // wait for the thread to leave, entering again afterwards sees the new state
+        while ( entered == s->entered.load( std::memory_order_acquire ) )
+            std::this_thread::yield();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+epoch::slot *epoch::local()
+{
+    // give the slot back when the thread exits
+    struct owner
+    {
+        slot *s;
+
+        owner() : s( acquire() ) {}
+        ~owner() {release( s );}
+    };
+
+    static thread_local owner o;
+
+    return o.s;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+epoch::slot *epoch::acquire()
+{
+    // reuse slot of exited thread
+    for ( slot *s = first_.load( std::memory_order_acquire ); s; s = s->next )
+    {
+        bool expected( false );
+
+        if (( !s->used.load( std::memory_order_relaxed ) ) &&
+            ( s->used.compare_exchange_strong( expected, true, std::memory_order_acquire ) ))
+            return s;
+    }
+
+    // slots are never freed, a thread may be walking the list
+    slot *s( new slot );
+    s->entered.store( 0, std::memory_order_relaxed );
+    s->used.store( true, std::memory_order_relaxed );
+    s->depth = 0;
+    s->next = first_.load( std::memory_order_relaxed );
+
+    while ( !first_.compare_exchange_weak( s->next, s, std::memory_order_release, std::memory_order_relaxed ) )
+        ;
+
+    return s;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void epoch::release( slot *s )
+{
+    s->depth = 0;
+    s->entered.store( 0, std::memory_order_release );
+    s->used.store( false, std::memory_order_release );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace clio
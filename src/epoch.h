@@ -0,0 +1,123 @@
+/**
+ * @file epoch.h
+ * @brief Epoch based reclamation of shared state.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef EPOCH_H
+#define EPOCH_H
+
+#include "clioapi.h"
+
+#include <atomic>
+#include <cstdint>
+
+/// Clio namespace.
+namespace clio
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Epoch based reclamation class.
+/**
+ * Threads reading shared state published through an atomic pointer mark themselves as reading
+ * with a @c guard. Each thread announces itself in a slot of its own, so readers never take a
+ * lock or write to memory shared with other readers.
+ *
+ * A writer swaps in the new state and then calls synchronize(), which waits until every thread
+ * that was reading at the time has left. Nothing can reach the old state after that, so it may be
+ * closed and freed.
+ */
+class CLIO_API epoch
+{
+    typedef epoch _Myt;
+
+public:
+
+    /// Guard marking the calling thread as reading shared state.
+    class guard
+    {
+    public:
+
+        /// Constructor.
+        guard() {epoch::enter();}
+
+        /// Destructor.
+        ~guard() {epoch::leave();}
+
+    private:
+
+        // not implemented
+        guard( const guard& ) = delete;
+
+        // not implemented
+        guard& operator = ( const guard& ) = delete;
+
+    };
+
+    // ========================================================================
+    // Static Methods
+    // ========================================================================
+
+    /// Mark calling thread as reading, may be nested.
+    static void enter();
+
+    /// Mark calling thread as done reading.
+    static void leave();
+
+    /// Wait for threads reading when called to leave.
+    /**
+     * The calling thread is not waited for, state it is reading itself must outlive its guard.
+     */
+    static void synchronize();
+
+private:
+
+    /// Per thread slot.
+    struct alignas(64) slot
+    {
+        std::atomic<std::uint64_t> entered;         ///< epoch when entered, zero when not reading
+        std::atomic<bool> used;                     ///< owned by a thread
+        unsigned int depth;                         ///< guards held, only touched by owner
+        slot *next;                                 ///< next slot in list
+    };
+
+    static std::atomic<std::uint64_t> current_;
+    static std::atomic<slot*> first_;
+
+    // ========================================================================
+
+    /// Retrieve slot of calling thread.
+    static slot *local();
+
+    /// Claim free slot or add new one.
+    static slot *acquire();
+
+    /// Give up slot of exited thread.
+    static void release( slot *s );
+
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace clio
+
+#endif // EPOCH_H
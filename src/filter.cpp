@@ -0,0 +1,95 @@
+/**
+ * @file filter.cpp
+ * @brief Base filter class.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "filter.h"
+
+/// Clio namespace.
+namespace clio
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+filter::filter() :
+    _Mybase(),
+    onMatch_( Neutral ),
+    onMismatch_( Deny )
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+filter::~filter()
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void filter::setOnMatch( decision value )
+{
+    _Mybase::setProp( PROP_ONMATCH, toString( value ) );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void filter::setOnMismatch( decision value )
+{
+    _Mybase::setProp( PROP_ONMISMATCH, toString( value ) );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void filter::propertyChanged( const std::string& name )
+{
+    if ( PROP_ONMATCH == name )
+        onMatch_ = fromString( _Mybase::prop<std::string>( name ), Neutral );
+    else if ( PROP_ONMISMATCH == name )
+        onMismatch_ = fromString( _Mybase::prop<std::string>( name ), Deny );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+filter::decision filter::fromString( const std::string& value, decision defaultValue )
+{
+    if ( "ACCEPT" == value )
+        return Accept;
+    else if ( "DENY" == value )
+        return Deny;
+    else if ( "NEUTRAL" == value )
+        return Neutral;
+
+    return defaultValue;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+std::string filter::toString( decision value )
+{
+    if ( Accept == value )
+        return "ACCEPT";
+    else if ( Deny == value )
+        return "DENY";
+
+    return "NEUTRAL";
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace clio
@@ -0,0 +1,168 @@
+/**
+ * @file filter.h
+ * @brief Base filter class.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef FILTER_H
+#define FILTER_H
+
+#include "propertymap.h"
+
+#include <string>
+
+/// Clio namespace.
+namespace clio
+{
+
+class logRecord;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Filter base class.
+/**
+ * Appenders run their filters in order before formatting a record. Each filter decides whether
+ * the record matches, then acts as set for a match or mismatch:
+ * @arg ACCEPT - write the record, skipping the remaining filters
+ * @arg DENY - drop the record
+ * @arg NEUTRAL - leave it to the remaining filters
+ *
+ * Records no filter accepts or denies are written. With the defaults, NEUTRAL on match and DENY
+ * on mismatch, a chain of filters only writes records matching all of them.
+ *
+ * Properties you may set:
+ * @arg onMatch - action for a matching record
+ * @arg onMismatch - action for a record not matching
+ */
+class filter : public propertyMap
+{
+    typedef filter _Myt;
+    typedef propertyMap _Mybase;
+
+public:
+
+    /// On match property.
+    static constexpr const char *PROP_ONMATCH = "onMatch";
+
+    /// On mismatch property.
+    static constexpr const char *PROP_ONMISMATCH = "onMismatch";
+
+    /// Filter decisions.
+    enum decision
+    {
+        Deny,                                       ///< drop record
+        Neutral,                                    ///< leave to remaining filters
+        Accept,                                     ///< write record
+    };
+
+    // ========================================================================
+    // DTOR
+    // ========================================================================
+
+    /// Destructor.
+    virtual ~filter();
+
+    // ========================================================================
+    // Properties
+    // ========================================================================
+
+    /// Retrieve action for a matching record.
+    /**
+     * @return  decision
+     */
+    virtual decision onMatch() const {return onMatch_;}
+
+    /// Set action for a matching record.
+    /**
+     * @param[in] value  decision
+     */
+    virtual void setOnMatch( decision value );
+
+    /// Retrieve action for a record not matching.
+    /**
+     * @return  decision
+     */
+    virtual decision onMismatch() const {return onMismatch_;}
+
+    /// Set action for a record not matching.
+    /**
+     * @param[in] value  decision
+     */
+    virtual void setOnMismatch( decision value );
+
+    // ========================================================================
+    // Methods
+    // ========================================================================
+
+    /// Decide what to do with a log record.
+    /**
+     * @param[in] record  log record
+     * @return  decision
+     */
+    decision decide( const logRecord& record ) const {return ( matches( record ) ? onMatch_ : onMismatch_ );}
+
+protected:
+
+    // ========================================================================
+    // CTOR
+    // ========================================================================
+
+    /// Constructor.
+    filter();
+
+    // ========================================================================
+    // Methods
+    // ========================================================================
+
+    /// Check if log record matches.
+    /**
+     * @param[in] record  log record
+     * @return  @c true if matches, @c false otherwise
+     */
+    virtual bool matches( const logRecord& record ) const = 0;
+
+    /// Property was set.
+    /**
+     * @param[in] name  property name
+     */
+    virtual void propertyChanged( const std::string& name );
+
+private:
+
+    decision onMatch_;
+    decision onMismatch_;
+
+    // ========================================================================
+
+    /// Convert decision from string.
+    static decision fromString( const std::string& value, decision defaultValue );
+
+    /// Convert decision to string.
+    static std::string toString( decision value );
+
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace clio
+
+#endif // FILTER_H
@@ -0,0 +1,50 @@
+/**
+ * @file filterfactory.cpp
+ * @brief Filter factory class.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "filterfactory.h"
+
+#include "filters/levelrangefilter.h"
+#include "filters/loggernamefilter.h"
+#include "filters/messageprefixfilter.h"
+
+/// Clio namespace.
+namespace clio
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+filter *filterFactory::create( const std::string& type )
+{
+    if ( levelRangeFilter::TYPE == type )
+        return new levelRangeFilter();
+    else if ( loggerNameFilter::TYPE == type )
+        return new loggerNameFilter();
+    else if ( messagePrefixFilter::TYPE == type )
+        return new messagePrefixFilter();
+
+    return nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace clio
@@ -0,0 +1,82 @@
+/**
+ * @file levelrangefilter.cpp
+ * @brief Level range filter class.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "levelrangefilter.h"
+
+#include "../logrecord.h"
+
+/// Clio namespace.
+namespace clio
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+levelRangeFilter::levelRangeFilter() :
+    _Mybase(),
+    levelMin_( logLevel::Everything ),
+    levelMax_( logLevel::Fatal )
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+levelRangeFilter::~levelRangeFilter()
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void levelRangeFilter::setLevelMin( logLevel::type value )
+{
+    _Mybase::setProp( PROP_LEVELMIN, logLevel::toString( value ) );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void levelRangeFilter::setLevelMax( logLevel::type value )
+{
+    _Mybase::setProp( PROP_LEVELMAX, logLevel::toString( value ) );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool levelRangeFilter::matches( const logRecord& record ) const
+{
+    // more severe levels are lower
+    return (( levelMax_ <= record.level() ) && ( record.level() <= levelMin_ ));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void levelRangeFilter::propertyChanged( const std::string& name )
+{
+    if ( PROP_LEVELMIN == name )
+        levelMin_ = logLevel::fromString( _Mybase::prop<std::string>( name ) );
+    else if ( PROP_LEVELMAX == name )
+        levelMax_ = logLevel::fromString( _Mybase::prop<std::string>( name ) );
+
+    _Mybase::propertyChanged( name );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace clio
@@ -0,0 +1,130 @@
+/**
+ * @file levelrangefilter.h
+ * @brief Level range filter class.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LEVELRANGEFILTER_H
+#define LEVELRANGEFILTER_H
+
+#include "../filter.h"
+#include "../loglevel.h"
+
+/// Clio namespace.
+namespace clio
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Level range filter class.
+/**
+ * Matches records with a level between two levels.
+ *
+ * Properties you may set:
+ * @arg levelMin - least severe level matched (i.e. DEBUG)
+ * @arg levelMax - most severe level matched (i.e. ERROR)
+ */
+class levelRangeFilter : public filter
+{
+    typedef levelRangeFilter _Myt;
+    typedef filter _Mybase;
+
+public:
+
+    /// Filter type, as named in config files.
+    static constexpr const char *TYPE = "levelRangeFilter";
+
+    /// Least severe level property.
+    static constexpr const char *PROP_LEVELMIN = "levelMin";
+
+    /// Most severe level property.
+    static constexpr const char *PROP_LEVELMAX = "levelMax";
+
+    // ========================================================================
+    // CTOR / DTOR
+    // ========================================================================
+
+    /// Constructor.
+    levelRangeFilter();
+
+    /// Destructor.
+    virtual ~levelRangeFilter();
+
+    // ========================================================================
+    // Properties
+    // ========================================================================
+
+    /// Retrieve least severe level matched.
+    /**
+     * @return  log level
+     */
+    virtual logLevel::type levelMin() const {return levelMin_;}
+
+    /// Set least severe level matched.
+    /**
+     * @param[in] value  log level
+     */
+    virtual void setLevelMin( logLevel::type value );
+
+    /// Retrieve most severe level matched.
+    /**
+     * @return  log level
+     */
+    virtual logLevel::type levelMax() const {return levelMax_;}
+
+    /// Set most severe level matched.
+    /**
+     * @param[in] value  log level
+     */
+    virtual void setLevelMax( logLevel::type value );
+
+protected:
+
+    // ========================================================================
+    // Methods
+    // ========================================================================
+
+    /// Check if log record matches.
+    /**
+     * @param[in] record  log record
+     * @return  @c true if matches, @c false otherwise
+     */
+    virtual bool matches( const logRecord& record ) const;
+
+    /// Property was set.
+    /**
+     * @param[in] name  property name
+     */
+    virtual void propertyChanged( const std::string& name );
+
+private:
+
+    logLevel::type levelMin_;
+    logLevel::type levelMax_;
+
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace clio
+
+#endif // LEVELRANGEFILTER_H
@@ -0,0 +1,84 @@
+/**
+ * @file loggernamefilter.cpp
+ * @brief Logger name filter class.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "loggernamefilter.h"
+
+#include "../callsite.h"
+#include "../logrecord.h"
+
+/// Clio namespace.
+namespace clio
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+loggerNameFilter::loggerNameFilter() :
+    _Mybase()
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+loggerNameFilter::~loggerNameFilter()
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void loggerNameFilter::setLoggerName( const std::string& value )
+{
+    _Mybase::setProp( PROP_LOGGERNAME, value );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool loggerNameFilter::matches( const logRecord& record ) const
+{
+    const callSite& site( record.site() );
+
+    // call sites get their name when they register
+    if ( !site.loggerName().empty() )
+        return pattern_.matches( site.loggerName() );
+
+    static thread_local std::string name;
+    name = callSite::buildLoggerName( site.moduleName(), site.className(), site.classFunction() );
+
+    return pattern_.matches( name );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void loggerNameFilter::propertyChanged( const std::string& name )
+{
+    if ( PROP_LOGGERNAME == name )
+    {
+        loggerName_ = _Mybase::prop<std::string>( name );
+        pattern_ = globPattern( loggerName_ );
+    }
+
+    _Mybase::propertyChanged( name );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace clio
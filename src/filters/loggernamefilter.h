@@ -0,0 +1,117 @@
+/**
+ * @file loggernamefilter.h
+ * @brief Logger name filter class.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LOGGERNAMEFILTER_H
+#define LOGGERNAMEFILTER_H
+
+#include "../filter.h"
+#include "../namematcher.h"
+
+#include <string>
+
+/// Clio namespace.
+namespace clio
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Logger name filter class.
+/**
+ * Matches records logged from a call site whose logger name (module.class.method) matches a
+ * pattern, which may have '*' and '?' wildcards like logger names in the configuration.
+ *
+ * Properties you may set:
+ * @arg loggerName - logger name pattern (i.e. net.*)
+ */
+class loggerNameFilter : public filter
+{
+    typedef loggerNameFilter _Myt;
+    typedef filter _Mybase;
+
+public:
+
+    /// Filter type, as named in config files.
+    static constexpr const char *TYPE = "loggerNameFilter";
+
+    /// Logger name property.
+    static constexpr const char *PROP_LOGGERNAME = "loggerName";
+
+    // ========================================================================
+    // CTOR / DTOR
+    // ========================================================================
+
+    /// Constructor.
+    loggerNameFilter();
+
+    /// Destructor.
+    virtual ~loggerNameFilter();
+
+    // ========================================================================
+    // Properties
+    // ========================================================================
+
+    /// Retrieve logger name pattern.
+    /**
+     * @return  logger name pattern
+     */
+    virtual std::string loggerName() const {return loggerName_;}
+
+    /// Set logger name pattern.
+    /**
+     * @param[in] value  logger name pattern
+     */
+    virtual void setLoggerName( const std::string& value );
+
+protected:
+
+    // ========================================================================
+    // Methods
+    // ========================================================================
+
+    /// Check if log record matches.
+    /**
+     * @param[in] record  log record
+     * @return  @c true if matches, @c false otherwise
+     */
+    virtual bool matches( const logRecord& record ) const;
+
+    /// Property was set.
+    /**
+     * @param[in] name  property name
+     */
+    virtual void propertyChanged( const std::string& name );
+
+private:
+
+    std::string loggerName_;
+    globPattern pattern_;
+
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace clio
+
+#endif // LOGGERNAMEFILTER_H
@@ -0,0 +1,75 @@
+/**
+ * @file messageprefixfilter.cpp
+ * @brief Message prefix filter class.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "messageprefixfilter.h"
+
+#include "../logrecord.h"
+
+#include <string_view>
+
+/// Clio namespace.
+namespace clio
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+messagePrefixFilter::messagePrefixFilter() :
+    _Mybase()
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+messagePrefixFilter::~messagePrefixFilter()
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void messagePrefixFilter::setPrefix( const std::string& value )
+{
+    _Mybase::setProp( PROP_PREFIX, value );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool messagePrefixFilter::matches( const logRecord& record ) const
+{
+    const std::string_view text( record.text() );
+
+    return (( prefix_.size() <= text.size() ) && ( 0 == text.compare( 0, prefix_.size(), prefix_ ) ));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void messagePrefixFilter::propertyChanged( const std::string& name )
+{
+    if ( PROP_PREFIX == name )
+        prefix_ = _Mybase::prop<std::string>( name );
+
+    _Mybase::propertyChanged( name );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace clio
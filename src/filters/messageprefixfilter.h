@@ -0,0 +1,114 @@
+/**
+ * @file messageprefixfilter.h
+ * @brief Message prefix filter class.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef MESSAGEPREFIXFILTER_H
+#define MESSAGEPREFIXFILTER_H
+
+#include "../filter.h"
+
+#include <string>
+
+/// Clio namespace.
+namespace clio
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Message prefix filter class.
+/**
+ * Matches records whose message starts with a prefix.
+ *
+ * Properties you may set:
+ * @arg prefix - message prefix
+ */
+class messagePrefixFilter : public filter
+{
+    typedef messagePrefixFilter _Myt;
+    typedef filter _Mybase;
+
+public:
+
+    /// Filter type, as named in config files.
+    static constexpr const char *TYPE = "messagePrefixFilter";
+
+    /// Prefix property.
+    static constexpr const char *PROP_PREFIX = "prefix";
+
+    // ========================================================================
+    // CTOR / DTOR
+    // ========================================================================
+
+    /// Constructor.
+    messagePrefixFilter();
+
+    /// Destructor.
+    virtual ~messagePrefixFilter();
+
+    // ========================================================================
+    // Properties
+    // ========================================================================
+
+    /// Retrieve message prefix.
+    /**
+     * @return  message prefix
+     */
+    virtual std::string prefix() const {return prefix_;}
+
+    /// Set message prefix.
+    /**
+     * @param[in] value  message prefix
+     */
+    virtual void setPrefix( const std::string& value );
+
+protected:
+
+    // ========================================================================
+    // Methods
+    // ========================================================================
+
+    /// Check if log record matches.
+    /**
+     * @param[in] record  log record
+     * @return  @c true if matches, @c false otherwise
+     */
+    virtual bool matches( const logRecord& record ) const;
+
+    /// Property was set.
+    /**
+     * @param[in] name  property name
+     */
+    virtual void propertyChanged( const std::string& name );
+
+private:
+
+    std::string prefix_;
+
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace clio
+
+#endif // MESSAGEPREFIXFILTER_H
@@ -0,0 +1,209 @@
+/**
+ * @file formatstring.cpp
+ * @brief Compile time checked format string classes.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "formatstring.h"
+
+#include <cctype>
+#include <charconv>
+#include <cstring>
+#include <vector>
+
+/// Clio namespace.
+namespace clio
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+template <class T>
+void formatStringBase::appendFloatImpl( textBuffer& out, const spec& s, T value )
+{
+    std::chars_format fmt( std::chars_format::general );
+
+    switch ( s.type )
+    {
+    case 'f': case 'F': fmt = std::chars_format::fixed; break;
+    case 'e': case 'E': fmt = std::chars_format::scientific; break;
+    default: break;
+    }
+
+    const int precision(( s.precision < 0 ) ? 6 : s.precision );
+
+    char temp[128];
+
+    char *first( temp );
+    char *last( temp + sizeof(temp) );
+
+    std::vector<char> large;
+
+    std::to_chars_result result( std::to_chars( first, last, value, fmt, precision ) );
+
+    // huge fixed point values need more room
+    if ( std::errc::value_too_large == result.ec )
+    {
+        large.resize( 5000 + precision );
+
+        first = large.data();
+        last = first + large.size();
+
+        result = std::to_chars( first, last, value, fmt, precision );
+    }
+
+    if ( std::errc() != result.ec )
+        return;
+
+    if (( 'F' == s.type ) || ( 'E' == s.type ) || ( 'G' == s.type ))
+    {
+        for ( char *p = first; p != result.ptr; ++p )
+            *p = (char) std::toupper( (unsigned char) *p );
+    }
+
+    // sign is padded separately
+    char sign(( '-' == s.sign ) ? 0 : s.sign );
+
+    if (( first != result.ptr ) && ( '-' == *first ))
+    {
+        sign = '-';
+        ++first;
+    }
+
+    appendPadded( out, s, sign, std::string_view( first, result.ptr - first ), true );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void formatStringBase::appendEscaped( textBuffer& out, std::string_view value )
+{
+    std::string_view::size_type pos;
+
+    // drop one of each pair of braces
+    while ( std::string_view::npos != (pos = value.find_first_of( "{}" )) )
+    {
+        out.append( value.substr( 0, pos + 1 ) );
+        value.remove_prefix( pos + 2 );
+    }
+
+    out.append( value );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void formatStringBase::appendInteger( textBuffer& out, const spec& s, unsigned long long magnitude, bool negative )
+{
+    int base( 10 );
+
+    switch ( s.type )
+    {
+    case 'x': case 'X': base = 16; break;
+    case 'o': base = 8; break;
+    case 'b': base = 2; break;
+    default: break;
+    }
+
+    char temp[72];
+    const std::to_chars_result result( std::to_chars( temp, temp + sizeof(temp), magnitude, base ) );
+
+    if ( 'X' == s.type )
+    {
+        for ( char *p = temp; p != result.ptr; ++p )
+            *p = (char) std::toupper( (unsigned char) *p );
+    }
+
+    char sign( 0 );
+
+    if ( negative )
+        sign = '-';
+    else if (( '+' == s.sign ) || ( ' ' == s.sign ))
+        sign = s.sign;
+
+    appendPadded( out, s, sign, std::string_view( temp, result.ptr - temp ), true );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void formatStringBase::appendFloat( textBuffer& out, const spec& s, double value )
+{
+    appendFloatImpl( out, s, value );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void formatStringBase::appendFloat( textBuffer& out, const spec& s, long double value )
+{
+    appendFloatImpl( out, s, value );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void formatStringBase::appendText( textBuffer& out, const spec& s, std::string_view value )
+{
+    // precision truncates strings
+    if (( 0 <= s.precision ) && ( (std::size_t) s.precision < value.size() ))
+        value = value.substr( 0, s.precision );
+
+    appendPadded( out, s, 0, value, false );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void formatStringBase::appendPadded( textBuffer& out, const spec& s, char sign, std::string_view value, bool numeric )
+{
+    const std::size_t len( value.size() + (sign ? 1 : 0) );
+    const std::size_t padding(( len < s.width ) ? s.width - len : 0 );
+
+    // zeros go between sign and digits
+    if (( s.zero ) && ( !s.align ))
+    {
+        if ( sign )
+            out.append( sign );
+
+        std::memset( out.prepare( padding ), '0', padding );
+        out.commit( padding );
+
+        out.append( value );
+        return;
+    }
+
+    // numbers align right by default, everything else left
+    const char align( s.align ? s.align : (numeric ? '>' : '<') );
+
+    std::size_t before( 0 );
+
+    if ( '>' == align )
+        before = padding;
+    else if ( '^' == align )
+        before = padding / 2;
+
+    std::memset( out.prepare( before ), s.fill, before );
+    out.commit( before );
+
+    if ( sign )
+        out.append( sign );
+
+    out.append( value );
+
+    const std::size_t after( padding - before );
+
+    std::memset( out.prepare( after ), s.fill, after );
+    out.commit( after );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace clio
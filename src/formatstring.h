@@ -0,0 +1,569 @@
+/**
+ * @file formatstring.h
+ * @brief Compile time checked format string classes.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef FORMATSTRING_H
+#define FORMATSTRING_H
+
+#include "clioapi.h"
+#include "formatter.h"
+#include "textbuffer.h"
+
+#include <cstddef>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+/// Clio namespace.
+namespace clio
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Format string base class.
+/**
+ * Parsing and formatting that does not depend on the argument types.
+ */
+class CLIO_API formatStringBase
+{
+public:
+
+    /// Argument kinds.
+    enum argKind
+    {
+        Bool,
+        Char,
+        Integer,
+        Float,
+        String,
+        Other,
+    };
+
+    /// Field specification.
+    /**
+     * Parsed from the text following ':' in a field, i.e. "{:>8.3f}".
+     */
+    struct spec
+    {
+        char fill;              ///< Fill character.
+        char align;             ///< Alignment ('<', '>' or '^'), or zero for default.
+        char sign;              ///< Sign ('+', '-' or ' '), or zero for default.
+        bool zero;              ///< Pad numbers with zeros.
+        unsigned int width;     ///< Minimum width.
+        int precision;          ///< Precision, or -1 for default.
+        char type;              ///< Presentation type, or zero for default.
+
+        /// Constructor.
+        constexpr spec() :
+            fill( ' ' ),
+            align( 0 ),
+            sign( 0 ),
+            zero( false ),
+            width( 0 ),
+            precision( -1 ),
+            type( 0 )
+        {
+        }
+
+        /// Check if default specification.
+        /**
+         * @return  @c true if value is formatted as is, @c false otherwise
+         */
+        constexpr bool plain() const {return (( !align ) && ( !sign ) && ( !zero ) && ( !width ) && ( precision < 0 ) && ( !type ));}
+    };
+
+    /// Field.
+    struct field
+    {
+        std::string_view literal;   ///< Text preceding field.
+        bool escaped;               ///< Literal contains "{{" or "}}".
+        spec s;                     ///< Field specification.
+
+        /// Constructor.
+        constexpr field() :
+            literal(),
+            escaped( false ),
+            s()
+        {
+        }
+    };
+
+    // ========================================================================
+    // Static Methods
+    // ========================================================================
+
+    /// Retrieve argument kind of type @p T.
+    /**
+     * @return  argument kind
+     */
+    template <class T>
+    static constexpr argKind kindOf()
+    {
+        if constexpr ( std::is_same_v<T, bool> )
+            return Bool;
+        else if constexpr (( std::is_same_v<T, char> ) || ( std::is_same_v<T, signed char> ) || ( std::is_same_v<T, unsigned char> ))
+            return Char;
+        else if constexpr ( std::is_integral_v<T> )
+            return Integer;
+        else if constexpr ( std::is_floating_point_v<T> )
+            return Float;
+        else if constexpr (( std::is_same_v<T, const char*> ) || ( std::is_same_v<T, char*> ) || ( std::is_convertible_v<const T&, std::string_view> ))
+            return String;
+        else
+            return Other;
+    }
+
+protected:
+
+    // ========================================================================
+    // Static Methods
+    // ========================================================================
+
+    /// Parse field specification.
+    /**
+     * @param[in] text  text between braces
+     * @param[in] kind  kind of argument for field
+     * @return  field specification
+     */
+    static constexpr spec parseSpec( std::string_view text, argKind kind )
+    {
+        spec result;
+
+        if ( text.empty() )
+            return result;
+
+        if ( ':' != text[0] )
+            throw std::invalid_argument( "format field must be '{}' or '{:spec}'" );
+
+        text.remove_prefix( 1 );
+
+        // fill and align
+        if (( 1 < text.size() ) && ( isAlign( text[1] ) ))
+        {
+            result.fill = text[0];
+            result.align = text[1];
+            text.remove_prefix( 2 );
+        }
+        else if (( !text.empty() ) && ( isAlign( text[0] ) ))
+        {
+            result.align = text[0];
+            text.remove_prefix( 1 );
+        }
+
+        // sign
+        if (( !text.empty() ) && (( '+' == text[0] ) || ( '-' == text[0] ) || ( ' ' == text[0] )))
+        {
+            result.sign = text[0];
+            text.remove_prefix( 1 );
+        }
+
+        // zero padding
+        if (( !text.empty() ) && ( '0' == text[0] ))
+        {
+            result.zero = true;
+            text.remove_prefix( 1 );
+        }
+
+        // width
+        while (( !text.empty() ) && ( isDigit( text[0] ) ))
+        {
+            result.width = 10 * result.width + (text[0] - '0');
+            text.remove_prefix( 1 );
+        }
+
+        // precision
+        if (( !text.empty() ) && ( '.' == text[0] ))
+        {
+            text.remove_prefix( 1 );
+
+            if (( text.empty() ) || ( !isDigit( text[0] ) ))
+                throw std::invalid_argument( "format precision is missing" );
+
+            result.precision = 0;
+
+            while (( !text.empty() ) && ( isDigit( text[0] ) ))
+            {
+                result.precision = 10 * result.precision + (text[0] - '0');
+                text.remove_prefix( 1 );
+            }
+        }
+
+        // type
+        if ( !text.empty() )
+        {
+            result.type = text[0];
+            text.remove_prefix( 1 );
+        }
+
+        if ( !text.empty() )
+            throw std::invalid_argument( "format spec has unexpected characters" );
+
+        // check spec against argument
+        switch ( result.type )
+        {
+        case 0:
+            break;
+
+        case 'd':
+            if (( Integer != kind ) && ( Char != kind ))
+                throw std::invalid_argument( "format type 'd' needs an integer argument" );
+            break;
+
+        case 'x':
+        case 'X':
+        case 'o':
+        case 'b':
+            if ( Integer != kind )
+                throw std::invalid_argument( "format type 'x', 'X', 'o' or 'b' needs an integer argument" );
+            break;
+
+        case 'c':
+            if (( Integer != kind ) && ( Char != kind ))
+                throw std::invalid_argument( "format type 'c' needs an integer or character argument" );
+            break;
+
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+            if ( Float != kind )
+                throw std::invalid_argument( "format type 'f', 'e' or 'g' needs a floating point argument" );
+            break;
+
+        case 's':
+            if (( String != kind ) && ( Bool != kind ) && ( Char != kind ))
+                throw std::invalid_argument( "format type 's' needs a string argument" );
+            break;
+
+        default:
+            throw std::invalid_argument( "format type is unknown" );
+        }
+
+        const bool numeric(( Integer == kind ) || ( Float == kind ) || ( 'd' == result.type ));
+
+        if (( result.sign ) && ( !numeric ))
+            throw std::invalid_argument( "format sign needs a numeric argument" );
+
+        if (( result.zero ) && ( !numeric ))
+            throw std::invalid_argument( "format zero padding needs a numeric argument" );
+
+        if (( 0 <= result.precision ) && ( Float != kind ) && ( String != kind ))
+            throw std::invalid_argument( "format precision needs a floating point or string argument" );
+
+        return result;
+    }
+
+    /// Append literal text.
+    /**
+     * @param[in,out] out  buffer to append to
+     * @param[in] value  literal text
+     * @param[in] escaped  @c true if text contains "{{" or "}}"
+     */
+    static void appendLiteral( textBuffer& out, std::string_view value, bool escaped )
+    {
+        if ( escaped )
+            appendEscaped( out, value );
+        else if ( !value.empty() )
+            out.append( value );
+    }
+
+    /// Append literal text with escaped braces.
+    /**
+     * @param[in,out] out  buffer to append to
+     * @param[in] value  literal text
+     */
+    static void appendEscaped( textBuffer& out, std::string_view value );
+
+    /// Append integer.
+    /**
+     * @param[in,out] out  buffer to append to
+     * @param[in] s  field specification
+     * @param[in] magnitude  absolute value
+     * @param[in] negative  @c true if value is negative
+     */
+    static void appendInteger( textBuffer& out, const spec& s, unsigned long long magnitude, bool negative );
+
+    /// Append floating point.
+    /**
+     * @param[in,out] out  buffer to append to
+     * @param[in] s  field specification
+     * @param[in] value  value
+     */
+    static void appendFloat( textBuffer& out, const spec& s, double value );
+
+    /// Append floating point.
+    /**
+     * @param[in,out] out  buffer to append to
+     * @param[in] s  field specification
+     * @param[in] value  value
+     */
+    static void appendFloat( textBuffer& out, const spec& s, long double value );
+
+    /// Append text.
+    /**
+     * @param[in,out] out  buffer to append to
+     * @param[in] s  field specification
+     * @param[in] value  text
+     */
+    static void appendText( textBuffer& out, const spec& s, std::string_view value );
+
+    /// Append value.
+    /**
+     * @param[in,out] out  buffer to append to
+     * @param[in] s  field specification
+     * @param[in] value  value
+     */
+    template <class T>
+    static void appendValue( textBuffer& out, const spec& s, const T& value )
+    {
+        constexpr argKind kind( kindOf<T>() );
+
+        // written as std::format does, unlike streaming
+        if constexpr ( Bool == kind )
+            appendText( out, s, value ? "true" : "false" );
+
+        // fast path, same as streaming the value
+        else if ( s.plain() )
+            formatter<T>::format( out, value );
+
+        else if constexpr (( Integer == kind ) || ( Char == kind ))
+        {
+            if ( 'c' == s.type )
+            {
+                const char c( static_cast<char>( value ) );
+                appendText( out, s, std::string_view( &c, 1 ) );
+            }
+            else if (( Char == kind ) && ( 'd' != s.type ))
+            {
+                const char c( static_cast<char>( value ) );
+                appendText( out, s, std::string_view( &c, 1 ) );
+            }
+            else if constexpr ( std::is_signed_v<T> )
+                appendInteger( out, s, (value < 0) ? 0ull - static_cast<unsigned long long>( value ) : static_cast<unsigned long long>( value ), value < 0 );
+            else
+                appendInteger( out, s, static_cast<unsigned long long>( value ), false );
+        }
+
+        else if constexpr ( Float == kind )
+        {
+            if constexpr ( std::is_same_v<T, long double> )
+                appendFloat( out, s, value );
+            else
+                appendFloat( out, s, static_cast<double>( value ) );
+        }
+
+        else if constexpr ( String == kind )
+        {
+            if constexpr (( std::is_same_v<T, const char*> ) || ( std::is_same_v<T, char*> ))
+                appendText( out, s, value ? std::string_view( value ) : std::string_view() );
+            else
+                appendText( out, s, std::string_view( value ) );
+        }
+
+        else
+        {
+            // only width and alignment apply, format to temporary first
+            inlineTextBuffer<256> temp;
+            formatter<T>::format( temp, value );
+
+            appendText( out, s, temp.view() );
+        }
+    }
+
+private:
+
+    /// Check for alignment character.
+    static constexpr bool isAlign( char c ) {return (( '<' == c ) || ( '>' == c ) || ( '^' == c ));}
+
+    /// Check for digit.
+    static constexpr bool isDigit( char c ) {return (( '0' <= c ) && ( c <= '9' ));}
+
+    /// Append floating point.
+    template <class T>
+    static void appendFloatImpl( textBuffer& out, const spec& s, T value );
+
+    /// Append padded text.
+    static void appendPadded( textBuffer& out, const spec& s, char sign, std::string_view value, bool numeric );
+
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Compile time checked format string.
+/**
+ * Fields are written as "{}" or "{:spec}" where spec is [[fill]align][sign][0][width][.precision][type]
+ * and type is one of d, x, X, o, b, c, f, F, e, E, g, G or s. Use "{{" and "}}" for literal braces.
+ *
+ * When declared @c constexpr the format string is parsed and checked against @p Args at compile
+ * time. A wrong number of fields, a bad spec or a spec that does not suit its argument type fails
+ * to compile. Formatting then runs in a single pass straight into a text buffer.
+ *
+ * The LOG_*_F macros declare one of these per call site.
+ */
+template <class... Args>
+class formatString : public formatStringBase
+{
+    typedef formatString<Args...> _Myt;
+    typedef formatStringBase _Mybase;
+
+public:
+
+    static const std::size_t FIELD_COUNT = sizeof...(Args);     ///< Number of fields.
+
+    // ========================================================================
+    // CTOR
+    // ========================================================================
+
+    /// Constructor.
+    /**
+     * @param[in] text  format string
+     */
+    constexpr explicit formatString( std::string_view text ) :
+        _Mybase(),
+        text_( text ),
+        fields_(),
+        tail_(),
+        tailEscaped_( false )
+    {
+        parse();
+    }
+
+    // ========================================================================
+    // Properties
+    // ========================================================================
+
+    /// Retrieve format string.
+    /**
+     * @return  format string
+     */
+    constexpr std::string_view text() const {return text_;}
+
+    // ========================================================================
+    // Methods
+    // ========================================================================
+
+    /// Append formatted arguments.
+    /**
+     * @param[in,out] out  buffer to append to
+     * @param[in] args  arguments
+     */
+    template <class... A>
+    void append( textBuffer& out, const A&... args ) const
+    {
+        static_assert( sizeof...(A) == FIELD_COUNT, "wrong number of format arguments" );
+        appendImpl( out, std::index_sequence_for<A...>(), args... );
+    }
+
+private:
+
+    static constexpr argKind kinds_[] = {_Mybase::kindOf<Args>()..., Other};
+
+    std::string_view text_;
+
+    field fields_[FIELD_COUNT ? FIELD_COUNT : 1];
+
+    std::string_view tail_;
+    bool tailEscaped_;
+
+    // ========================================================================
+
+    /// Parse format string.
+    constexpr void parse()
+    {
+        std::size_t count( 0 );
+        std::size_t begin( 0 );
+        bool escaped( false );
+
+        for ( std::size_t pos = 0; pos < text_.size(); ++pos )
+        {
+            const char c( text_[pos] );
+
+            if (( '{' != c ) && ( '}' != c ))
+                continue;
+
+            // escaped brace
+            if (( pos + 1 < text_.size() ) && ( c == text_[pos+1] ))
+            {
+                escaped = true;
+                ++pos;
+                continue;
+            }
+
+            if ( '}' == c )
+                throw std::invalid_argument( "format string has unmatched '}'" );
+
+            const std::size_t end( text_.find( '}', pos ) );
+
+            if ( std::string_view::npos == end )
+                throw std::invalid_argument( "format string has unmatched '{'" );
+
+            if ( FIELD_COUNT <= count )
+                throw std::invalid_argument( "format string has more fields than arguments" );
+
+            field& f( fields_[count] );
+            f.literal = text_.substr( begin, pos - begin );
+            f.escaped = escaped;
+            f.s = parseSpec( text_.substr( pos + 1, end - pos - 1 ), kinds_[count] );
+
+            ++count;
+
+            begin = end + 1;
+            pos = end;
+            escaped = false;
+        }
+
+        if ( FIELD_COUNT != count )
+            throw std::invalid_argument( "format string has fewer fields than arguments" );
+
+        tail_ = text_.substr( begin );
+        tailEscaped_ = escaped;
+    }
+
+    /// Append formatted arguments.
+    template <std::size_t... I, class... A>
+    void appendImpl( textBuffer& out, std::index_sequence<I...>, const A&... args ) const
+    {
+        (( appendLiteral( out, fields_[I].literal, fields_[I].escaped ), appendValue<std::decay_t<const A&>>( out, fields_[I].s, args ) ), ...);
+        appendLiteral( out, tail_, tailEscaped_ );
+    }
+
+};
+
+/// Retrieve format string type for arguments.
+/**
+ * Only used to name a type, i.e. decltype( formatArgs( args... ) ).
+ *
+ * @param[in] args  arguments
+ * @return  format string type
+ */
+template <class... Args>
+formatString<std::decay_t<const Args&>...> formatArgs( const Args&... args );
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace clio
+
+#endif // FORMATSTRING_H
@@ -0,0 +1,224 @@
+/**
+ * @file formatter.h
+ * @brief Value formatter classes.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef FORMATTER_H
+#define FORMATTER_H
+
+#include "textbuffer.h"
+
+#include <charconv>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <sstream>
+
+/// Clio namespace.
+namespace clio
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Value formatter.
+/**
+ * Appends the text form of a value to a text buffer. Values streamed into a log record are
+ * formatted through this class.
+ *
+ * Numbers, characters and strings are written straight into the buffer. Any other type falls
+ * back to its @c std::ostream insertion operator, which costs a @c std::stringstream per value.
+ * Specialize this class to format your own types without the fallback:
+ * @code
+ * template <>
+ * struct clio::formatter<point>
+ * {
+ *     static void format( clio::textBuffer& out, const point& value )
+ *     {
+ *         clio::formatter<int>::format( out, value.x );
+ *         out.append( ',' );
+ *         clio::formatter<int>::format( out, value.y );
+ *     }
+ * };
+ * @endcode
+ */
+template <class T>
+struct formatter
+{
+    /// Format value.
+    /**
+     * @param[in,out] out  buffer to append to
+     * @param[in] value  value to format
+     */
+    static void format( textBuffer& out, const T& value )
+    {
+        std::stringstream os;
+        os << value;
+
+        out.append( os.str() );
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Integer formatter.
+template <class T>
+struct integerFormatter
+{
+    /// Format value.
+    /**
+     * @param[in,out] out  buffer to append to
+     * @param[in] value  value to format
+     */
+    static void format( textBuffer& out, T value )
+    {
+        // enough room for every digit and a sign
+        static const std::size_t MAX_LENGTH = std::numeric_limits<T>::digits10 + 2;
+
+        char *first( out.prepare( MAX_LENGTH ) );
+        const std::to_chars_result result( std::to_chars( first, first + MAX_LENGTH, value ) );
+
+        out.commit( result.ptr - first );
+    }
+};
+
+template <> struct formatter<short> : integerFormatter<short> {};                           ///< Integer formatter.
+template <> struct formatter<unsigned short> : integerFormatter<unsigned short> {};         ///< Integer formatter.
+template <> struct formatter<int> : integerFormatter<int> {};                               ///< Integer formatter.
+template <> struct formatter<unsigned int> : integerFormatter<unsigned int> {};             ///< Integer formatter.
+template <> struct formatter<long> : integerFormatter<long> {};                             ///< Integer formatter.
+template <> struct formatter<unsigned long> : integerFormatter<unsigned long> {};           ///< Integer formatter.
+template <> struct formatter<long long> : integerFormatter<long long> {};                   ///< Integer formatter.
+template <> struct formatter<unsigned long long> : integerFormatter<unsigned long long> {}; ///< Integer formatter.
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Floating point formatter.
+/**
+ * Values are written like a default @c std::ostream would, i.e. like printf "%g".
+ */
+template <class T>
+struct floatFormatter
+{
+    static const int PRECISION = 6;         ///< Significant digits.
+
+    /// Format value.
+    /**
+     * @param[in,out] out  buffer to append to
+     * @param[in] value  value to format
+     */
+    static void format( textBuffer& out, T value )
+    {
+        // sign, digits, point and exponent
+        static const std::size_t MAX_LENGTH = PRECISION + 16;
+
+        char *first( out.prepare( MAX_LENGTH ) );
+        const std::to_chars_result result( std::to_chars( first, first + MAX_LENGTH, value, std::chars_format::general, PRECISION ) );
+
+        out.commit( result.ptr - first );
+    }
+};
+
+template <> struct formatter<float> : floatFormatter<float> {};                             ///< Floating point formatter.
+template <> struct formatter<double> : floatFormatter<double> {};                           ///< Floating point formatter.
+template <> struct formatter<long double> : floatFormatter<long double> {};                 ///< Floating point formatter.
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Character formatter.
+template <class T>
+struct charFormatter
+{
+    /// Format value.
+    /**
+     * @param[in,out] out  buffer to append to
+     * @param[in] value  value to format
+     */
+    static void format( textBuffer& out, T value ) {out.append( static_cast<char>( value ) );}
+};
+
+template <> struct formatter<char> : charFormatter<char> {};                                ///< Character formatter.
+template <> struct formatter<signed char> : charFormatter<signed char> {};                  ///< Character formatter.
+template <> struct formatter<unsigned char> : charFormatter<unsigned char> {};              ///< Character formatter.
+
+/// Boolean formatter.
+/**
+ * Written as '1' or '0' like a default @c std::ostream would.
+ */
+template <>
+struct formatter<bool>
+{
+    /// Format value.
+    /**
+     * @param[in,out] out  buffer to append to
+     * @param[in] value  value to format
+     */
+    static void format( textBuffer& out, bool value ) {out.append( value ? '1' : '0' );}
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// String formatter.
+template <>
+struct formatter<std::string_view>
+{
+    /// Format value.
+    /**
+     * @param[in,out] out  buffer to append to
+     * @param[in] value  value to format
+     */
+    static void format( textBuffer& out, std::string_view value ) {out.append( value );}
+};
+
+/// String formatter.
+template <>
+struct formatter<std::string> : formatter<std::string_view> {};
+
+/// String formatter.
+template <>
+struct formatter<const char*>
+{
+    /// Format value.
+    /**
+     * @param[in,out] out  buffer to append to
+     * @param[in] value  null terminated string
+     */
+    static void format( textBuffer& out, const char *value )
+    {
+        if ( value )
+            out.append( std::string_view( value ) );
+    }
+};
+
+/// String formatter.
+template <>
+struct formatter<char*> : formatter<const char*> {};
+
+/// String literal formatter.
+template <std::size_t N>
+struct formatter<char[N]> : formatter<const char*> {};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace clio
+
+#endif // FORMATTER_H
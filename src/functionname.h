@@ -0,0 +1,223 @@
+/**
+ * @file functionname.h
+ * @brief Compile time function name parser.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef FUNCTIONNAME_H
+#define FUNCTIONNAME_H
+
+#include <string_view>
+
+/// Clio namespace.
+namespace clio
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Function name class.
+/**
+ * Splits function text (i.e. __PRETTY_FUNCTION__ macro) into module, class and function names.
+ * For example the text 'void a::b::c::foo( int bar )' yields module 'b', class 'c' and function
+ * 'foo'.
+ *
+ * Parsing is @c constexpr, so when declared as a @c static @c constexpr object the names are
+ * views into the function text held in static storage and no work is done at run time.
+ */
+class functionName
+{
+    typedef functionName _Myt;
+
+public:
+
+    // ========================================================================
+    // CTOR
+    // ========================================================================
+
+    /// Constructor.
+    constexpr functionName() :
+        moduleName_(),
+        className_(),
+        classFunction_()
+    {
+    }
+
+    /// Constructor.
+    /**
+     * @param[in] function  function text
+     */
+    constexpr explicit functionName( std::string_view function ) :
+        moduleName_(),
+        className_(),
+        classFunction_()
+    {
+        parse( function );
+    }
+
+    /// Constructor.
+    /**
+     * @param[in] moduleName  module/library name
+     * @param[in] className  class name
+     * @param[in] classFunction  class function name
+     */
+    constexpr functionName( std::string_view moduleName, std::string_view className, std::string_view classFunction ) :
+        moduleName_( moduleName ),
+        className_( className ),
+        classFunction_( classFunction )
+    {
+    }
+
+    // ========================================================================
+    // Properties
+    // ========================================================================
+
+    /// Retrieve module name.
+    /**
+     * @return  module/library name
+     */
+    constexpr std::string_view moduleName() const {return moduleName_;}
+
+    /// Retrieve class name.
+    /**
+     * @return  class name
+     */
+    constexpr std::string_view className() const {return className_;}
+
+    /// Retrieve class function.
+    /**
+     * @return  class function name
+     */
+    constexpr std::string_view classFunction() const {return classFunction_;}
+
+private:
+
+    std::string_view moduleName_;
+    std::string_view className_;
+    std::string_view classFunction_;
+
+    // ========================================================================
+
+    /// Parse function text.
+    constexpr void parse( std::string_view function )
+    {
+        // we are looking for the function name only
+        // for example the string 'void class::foo( int bar )' we want only 'class::foo'
+        std::string_view::size_type end( function.find( '(' ) );
+
+        // call operator, parameters follow its own parentheses
+        if (( std::string_view::npos != end ) && ( end == operatorStart( function, end + 1 ) ))
+            end = function.find( '(', end + 2 );
+
+        if ( std::string_view::npos == end )
+            end = function.size();
+
+        // walk back to the start of the name, skipping over any template arguments
+        std::string_view::size_type begin( end );
+        int depth( 0 );
+
+        for ( ; begin; --begin )
+        {
+            const char c( function[begin-1] );
+
+            // not a template bracket, i.e. 'operator>>'
+            if ( begin != operatorStart( function, begin ) )
+                begin = operatorStart( function, begin ) + 1;
+            else if ( '>' == c )
+                ++depth;
+            else if (( '<' == c ) && ( depth ))
+                --depth;
+            else if (( ' ' == c ) && ( !depth ))
+                break;
+        }
+
+        std::string_view name( function.substr( begin, end - begin ) );
+
+        // pop off names from the back: function, class and then module
+        classFunction_ = popName( name );
+
+        if ( name.empty() )
+            return;
+
+        className_ = popName( name );
+
+        if ( name.empty() )
+            return;
+
+        moduleName_ = popName( name );
+    }
+
+    /// Remove last '::' separated name.
+    static constexpr std::string_view popName( std::string_view& name )
+    {
+        int depth( 0 );
+
+        for ( std::string_view::size_type pos = name.size(); pos; --pos )
+        {
+            const char c( name[pos-1] );
+
+            if ( pos != operatorStart( name, pos ) )
+                pos = operatorStart( name, pos ) + 1;
+            else if ( '>' == c )
+                ++depth;
+            else if (( '<' == c ) && ( depth ))
+                --depth;
+            else if (( ':' == c ) && ( !depth ) && ( 1 < pos ) && ( ':' == name[pos-2] ))
+            {
+                const std::string_view result( name.substr( pos ) );
+                name = name.substr( 0, pos - 2 );
+                return result;
+            }
+        }
+
+        const std::string_view result( name );
+        name = std::string_view();
+        return result;
+    }
+
+    /// Retrieve start of operator symbol ending at @p pos.
+    /**
+     * @param[in] text  function text
+     * @param[in] pos  position just past a character of the symbol
+     * @return  position of first symbol character after 'operator', or @p pos if not an operator
+     */
+    static constexpr std::string_view::size_type operatorStart( std::string_view text, std::string_view::size_type pos )
+    {
+        constexpr std::string_view keyword( "operator" );
+        constexpr std::string_view symbols( "<>=-()" );
+
+        std::string_view::size_type start( pos );
+
+        while (( start ) && ( std::string_view::npos != symbols.find( text[start-1] ) ))
+            --start;
+
+        if (( start == pos ) || ( start < keyword.size() ) || ( keyword != text.substr( start - keyword.size(), keyword.size() ) ))
+            return pos;
+
+        return start;
+    }
+
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace clio
+
+#endif // FUNCTIONNAME_H
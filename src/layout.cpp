@@ -28,11 +28,17 @@
 
 #include "layout.h"
 #include "logline.h"
+#include "logrecord.h"
+
+#include <typeinfo>
 
 /// Clio namespace.
 namespace clio
 {
 
+/// Record copied by formatTo() on this thread, for the default overloads forwarding to each other.
+static thread_local const logRecord *copied( nullptr );
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 layout::layout() :
     _Mybase()
@@ -47,7 +53,54 @@ layout::~layout()
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 std::string layout::format( const logLine& line ) const
 {
-    return line.text();
+    return format( line.record() );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+std::string layout::format( const logRecord& record ) const
+{
+    std::string result;
+    formatTo( record, result );
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void layout::formatTo( const logRecord& record, std::string& out ) const
+{
+    // record copied below came back, none of the overloads is implemented
+    if ( &record == copied )
+    {
+        out.append( record.text() );
+        return;
+    }
+
+    const logLine line( record );
+
+    // restored even when formatting throws
+    struct mark
+    {
+        explicit mark( const logRecord *value ) : prev( copied ) {copied = value;}
+        ~mark() {copied = prev;}
+
+        const logRecord *prev;
+    };
+
+    mark hold( &line.record() );
+
+    out.append( format( line ) );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void layout::formatTo( const logRecord& record, lineSegments& out ) const
+{
+    formatTo( record, out.scratch() );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool layout::equivalent( const layout& other ) const
+{
+    return (( typeid( *this ) == typeid( other ) ) && ( sameProperties( other ) ));
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -27,17 +27,120 @@
 
 #include "propertymap.h"
 
+#include <cstddef>
 #include <string>
+#include <string_view>
+#include <vector>
 
 /// Clio namespace.
 namespace clio
 {
 
 class logLine;
+class logRecord;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Formatted line made of pieces.
+/**
+ * Rendered text is appended to a scratch buffer. Large text that stays put while the line is
+ * written, like the message of the record being formatted, may be referenced instead of copied so
+ * appenders can pass it on to the system as is.
+ */
+class lineSegments
+{
+public:
+
+    static const std::size_t MIN_REFERENCE = 256;  ///< Smaller text is copied.
+
+    /// Remove all pieces.
+    void clear()
+    {
+        scratch_.clear();
+        parts_.clear();
+        mark_ = 0;
+    }
+
+    /// Retrieve scratch buffer, for appending rendered text.
+    std::string& scratch() {return scratch_;}
+
+    /// Append text, referencing it if large.
+    /**
+     * @param[in] value  text, must stay valid until the line is written
+     */
+    void reference( std::string_view value )
+    {
+        if ( value.size() < MIN_REFERENCE )
+        {
+            scratch_.append( value );
+            return;
+        }
+
+        // close scratch piece
+        if ( mark_ < scratch_.size() )
+            parts_.push_back( {nullptr, mark_, scratch_.size() - mark_} );
+
+        parts_.push_back( {value.data(), 0, value.size()} );
+        mark_ = scratch_.size();
+    }
+
+    /// Visit pieces in order.
+    /**
+     * @param[in] func  called with each piece and whether it is referenced
+     */
+    template <class F>
+    void forEach( F func ) const
+    {
+        for ( const part& p: parts_ )
+        {
+            if ( p.ref )
+                func( std::string_view( p.ref, p.len ), true );
+            else
+                func( std::string_view( scratch_.data() + p.offset, p.len ), false );
+        }
+
+        if ( mark_ < scratch_.size() )
+            func( std::string_view( scratch_.data() + mark_, scratch_.size() - mark_ ), false );
+    }
+
+    /// Retrieve line as a single piece, joining the pieces if text is referenced.
+    std::string_view view() const
+    {
+        if ( parts_.empty() )
+            return scratch_;
+
+        joined_.clear();
+        forEach( [this]( std::string_view piece, bool ) {joined_.append( piece );} );
+
+        return joined_;
+    }
+
+private:
+
+    /// Piece of line, in scratch buffer unless referenced.
+    struct part
+    {
+        const char *ref;
+        std::size_t offset;
+        std::size_t len;
+    };
+
+    std::string scratch_;
+    std::vector<part> parts_;
+    std::size_t mark_ = 0;
+
+    mutable std::string joined_;
+
+};
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// Layout base class.
+/**
+ * Layouts implement formatTo(), appending to a buffer the caller reuses so formatting a record
+ * need not allocate. Layouts implementing only format() still work, formatTo() appends its result,
+ * and layouts formatting a @c logLine are passed a copy of the record.
+ */
 class layout : public propertyMap
 {
     typedef layout _Myt;
@@ -58,11 +161,51 @@ public:
 
     /// Format a log line into string form suitable for output.
     /**
+     * The default formats the record of the line.
+     *
      * @param[in] line  log line
      * @return  formatted log line
      */
     virtual std::string format( const logLine& line ) const;
 
+    /// Format a log record into string form suitable for output.
+    /**
+     * The default returns formatTo() output.
+     *
+     * @param[in] record  log record
+     * @return  formatted log record
+     */
+    virtual std::string format( const logRecord& record ) const;
+
+    /// Format a log record, appending it to a buffer.
+    /**
+     * The default formats a log line copied from the record, which is the text of the record
+     * unless a format() overload is implemented.
+     *
+     * @param[in] record  log record
+     * @param[in,out] out  buffer to append formatted log record to
+     */
+    virtual void formatTo( const logRecord& record, std::string& out ) const;
+
+    /// Format a log record into pieces.
+    /**
+     * The default appends formatTo() output to the scratch buffer.
+     *
+     * @param[in] record  log record
+     * @param[in,out] out  line to append formatted log record to
+     */
+    virtual void formatTo( const logRecord& record, lineSegments& out ) const;
+
+    /// Check if another layout formats records the same way.
+    /**
+     * Loggers format a record once for all appenders with equivalent layouts. The default
+     * compares type and properties.
+     *
+     * @param[in] other  layout to compare with
+     * @return  @c true if equivalent, @c false otherwise
+     */
+    virtual bool equivalent( const layout& other ) const;
+
 protected:
 
     // ========================================================================
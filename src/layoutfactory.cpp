@@ -33,7 +33,7 @@ namespace clio
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 layout *layoutFactory::create( const std::string& type )
 {
-    if ( "patternLayout" == type )
+    if ( patternLayout::TYPE == type )
         return new patternLayout();
 
     return nullptr;
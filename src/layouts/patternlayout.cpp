@@ -28,36 +28,142 @@
 
 #include "patternlayout.h"
 
-#include "../logline.h"
+#include "../logrecord.h"
 
+#include <atomic>
+#include <charconv>
+#include <cctype>
+#include <climits>
 #include <cstdio>
 #include <ctime>
-#include <locale>
-#include <stdexcept>
-#include <sstream>
 
 /// Clio namespace.
 namespace clio
 {
 
+/// Date rendered for one second.
+struct renderedDate
+{
+    std::uint64_t id = 0;                                   ///< Date id.
+    long long second = 0;                                   ///< Seconds since epoch.
+    std::string text;                                       ///< Rendered date.
+    std::string::size_type millis = std::string::npos;      ///< Position of milliseconds in text.
+};
+
+/// Find rendered date for calling thread.
+/**
+ * A few dates are kept per thread, a layout with more than one date does not evict itself.
+ */
+static renderedDate& findRendered( std::uint64_t id )
+{
+    static thread_local renderedDate dates[4];
+    static thread_local unsigned int next( 0 );
+
+    for ( renderedDate& d: dates )
+        if ( id == d.id )
+            return d;
+
+    renderedDate& result( dates[next++ % 4] );
+    result.id = 0;
+
+    return result;
+}
+
+/// Convert seconds since epoch to broken down time, without consulting the time zone.
+static void civilTime( long long t, tm& stamp )
+{
+    long long days( t / 86400 );
+    long long rem( t % 86400 );
+
+    if ( rem < 0 )
+    {
+        rem += 86400;
+        --days;
+    }
+
+    stamp.tm_hour = (int) (rem / 3600);
+    stamp.tm_min = (int) (rem % 3600 / 60);
+    stamp.tm_sec = (int) (rem % 60);
+
+    // 1970-01-01 was a thursday
+    stamp.tm_wday = (int) ((days % 7 + 11) % 7);
+
+    // days to civil date, with years starting in march so leap days come last
+    days += 719468;
+
+    const long long era(( 0 <= days ? days : days - 146096 ) / 146097 );
+    const unsigned int doe( (unsigned int) (days - era * 146097) );
+    const unsigned int yoe( (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365 );
+    const unsigned int doy( doe - (365 * yoe + yoe / 4 - yoe / 100) );
+    const unsigned int mp( (5 * doy + 2) / 153 );
+    const unsigned int month( mp < 10 ? mp + 3 : mp - 9 );
+    const long long year( yoe + era * 400 + (month <= 2 ? 1 : 0) );
+
+    const bool leap(( 0 == year % 4 ) && (( 0 != year % 100 ) || ( 0 == year % 400 )));
+
+    stamp.tm_year = (int) (year - 1900);
+    stamp.tm_mon = (int) (month - 1);
+    stamp.tm_mday = (int) (doy - (153 * mp + 2) / 5 + 1);
+    stamp.tm_yday = (int) ( mp < 10 ? doy + 59 + (leap ? 1 : 0) : doy - 306 );
+}
+
+/// Convert seconds since epoch to UTC time.
+static void utcTime( long long t, tm& stamp )
+{
+    civilTime( t, stamp );
+    stamp.tm_isdst = 0;
+#if !_WIN32
+    stamp.tm_gmtoff = 0;
+    stamp.tm_zone = "GMT";
+#endif
+}
+
+/// Convert seconds since epoch to local time.
+/**
+ * Looking up the time zone takes a process wide lock, so the offset found is reused by the calling
+ * thread for the rest of the quarter hour. Daylight saving changes fall on quarter hour boundaries.
+ */
+static void localTime( long long t, tm& stamp )
+{
+    const std::time_t temp( (std::time_t) t );
+
+#if _WIN32
+    ::localtime_s( &stamp, &temp );
+#else
+    static const long long SPAN = 15 * 60;
+
+    static thread_local struct
+    {
+        long long from = 0;
+        long long until = 0;
+        long offset = 0;
+        int isdst = 0;
+        const char *name = nullptr;
+    } zone;
+
+    if (( t < zone.from ) || ( zone.until <= t ))
+    {
+        ::localtime_r( &temp, &stamp );
+
+        zone.from = t - ((t % SPAN) + SPAN) % SPAN;
+        zone.until = zone.from + SPAN;
+        zone.offset = stamp.tm_gmtoff;
+        zone.isdst = stamp.tm_isdst;
+        zone.name = stamp.tm_zone;
+        return;
+    }
+
+    civilTime( t + zone.offset, stamp );
+    stamp.tm_isdst = zone.isdst;
+    stamp.tm_gmtoff = zone.offset;
+    stamp.tm_zone = zone.name;
+#endif
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 patternLayout::patternLayout() :
     _Mybase()
 {
-    // create list of all formats
-    formats_.push_back( "%date" );
-    formats_.push_back( "%epochms" );
-    formats_.push_back( "%epoch" );
-    formats_.push_back( "%thread" );
-    formats_.push_back( "%levelnum" );
-    formats_.push_back( "%level" );
-    formats_.push_back( "%module" );
-    formats_.push_back( "%class" );
-    formats_.push_back( "%method" );
-    formats_.push_back( "%message" );
-    formats_.push_back( "%file" );
-    formats_.push_back( "%linenum" );
-    formats_.push_back( "%newline" );
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -78,200 +184,488 @@ void patternLayout::setConversionPattern( const std::string& value )
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
-std::string patternLayout::format( const logLine& line ) const
+std::string patternLayout::format( const logRecord& record ) const
 {
-    std::string result( conversionPattern() );
+    std::string result;
+    result.reserve( 128 + record.text().size() );
 
-    // no pattern
-    if ( result.empty() )
-        return _Mybase::format( line );
+    formatTo( record, result );
 
-    std::string name;
-    std::string format;
+    return result;
+}
 
-    // formats
-    while ( findFormat( result, name, format ) )
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void patternLayout::formatTo( const logRecord& record, std::string& result ) const
+{
+    // no pattern
+    if ( program_.empty() )
     {
-        char value[4096];
-        char *valuep( nullptr );
+        result.append( record.text() );
+        return;
+    }
 
-        // validate format
-        if ( !format.length() )
-        {
-            // date format
-            if ( std::string::npos != name.find( "%date" ) )
-                format = DEFAULT_DATE_FORMAT;
-
-            // long numeric format
-            else if ( std::string::npos != name.find( "%epochms" ) )
-                format = DEFAULT_LARGE_NUMBER_FORMAT;
-
-            // numeric format
-            else if (( std::string::npos != name.find( "%thread" ) ) ||
-                ( std::string::npos != name.find( "%levelnum" ) ) ||
-                ( std::string::npos != name.find( "%linenum" ) ) ||
-                ( std::string::npos != name.find( "%epoch" ) ))
-                format = DEFAULT_NUMBER_FORMAT;
-
-            // string format
-            else
-                format = DEFAULT_STRING_FORMAT;
-        }
+    for ( const op& o: program_ )
+        appendOp( result, o, record );
+}
 
-        // create formatted string
-        if ( std::string::npos != name.find( "%date" ) )
-        {
-            std::string::size_type pos;
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void patternLayout::formatTo( const logRecord& record, lineSegments& out ) const
+{
+    // no pattern
+    if ( program_.empty() )
+    {
+        out.reference( record.text() );
+        return;
+    }
 
-            std::time_t temp( logLine::clock_type::to_time_t( line.timeStamp() ) );
+    for ( const op& o: program_ )
+    {
+        // large text is referenced rather than copied
+        if ( Literal == o.type )
+            out.reference( o.text );
+        else if (( Message == o.type ) && ( o.conv.simple ) && ( o.conv.precision < 0 ))
+        {
+            const std::string_view text( record.text() );
 
-            // look for milliseconds
-            if ( std::string::npos != (pos = format.find( "%L" )) )
-            {
-                logLine::clock_type::time_point rounded( logLine::clock_type::from_time_t( temp ) );
+            if ( !o.conv.left )
+                appendPadding( out.scratch(), o.conv, text.size(), ' ' );
 
-                if ( rounded > line.timeStamp() )
-                {
-                    --temp;
-                    rounded -= std::chrono::seconds( 1 );
-                }
+            out.reference( text );
 
-                char milliseconds[32];
-                std::snprintf( milliseconds, sizeof(milliseconds), "%03d", (int) std::chrono::duration_cast<std::chrono::milliseconds>( line.timeStamp() - rounded ).count() );
+            if ( o.conv.left )
+                appendPadding( out.scratch(), o.conv, text.size(), ' ' );
+        }
+        else
+            appendOp( out.scratch(), o, record );
+    }
+}
 
-                // replace
-                format.replace( pos, 2, milliseconds );
-            }
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void patternLayout::propertyChanged( const std::string& name )
+{
+    if ( PROP_CONVERSIONPATTERN == name )
+        compile( conversionPattern() );
+}
 
-            // format time
-            tm stamp;
-#if _WIN32
-            ::localtime_s( &stamp, &temp );
-#else
-            ::localtime_r( &temp, &stamp );
-#endif
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void patternLayout::compile( std::string_view pattern )
+{
+    // longer tokens before their prefixes
+    static const struct
+    {
+        std::string_view name;
+        opType type;
+    } tokens[] =
+    {
+        {"%date", Date},
+        {"%utcdate", UtcDate},
+        {"%epochms", EpochMs},
+        {"%epoch", Epoch},
+        {"%thread", Thread},
+        {"%levelnum", LevelNum},
+        {"%level", Level},
+        {"%module", Module},
+        {"%class", Class},
+        {"%method", Method},
+        {"%message", Message},
+        {"%file", File},
+        {"%linenum", LineNum},
+        {"%newline", NewLine},
+    };
+
+    static std::atomic<std::uint64_t> lastId( 0 );
+
+    program_.clear();
+
+    std::string literal;
+    std::string_view::size_type pos( 0 );
+
+    while ( pos < pattern.size() )
+    {
+        opType type( Literal );
+        std::string_view::size_type len( 0 );
 
-            std::strftime( value, sizeof( value ), format.c_str(), &stamp );
+        // look for token
+        if ( '%' == pattern[pos] )
+        {
+            for ( const auto& t: tokens )
+                if ( 0 == pattern.compare( pos, t.name.size(), t.name ) )
+                {
+                    type = t.type;
+                    len = t.name.size();
+                    break;
+                }
         }
 
-        else if ( std::string::npos != name.find( "%epochms" ) )
+        if ( Literal == type )
         {
-            const std::chrono::milliseconds epoch( std::chrono::duration_cast<std::chrono::milliseconds>( line.timeStamp().time_since_epoch() ) );
-            std::snprintf( value, sizeof(value), format.c_str(), epoch.count() );
+            literal.push_back( pattern[pos++] );
+            continue;
         }
 
-        else if ( std::string::npos != name.find( "%epoch" ) )
+        if ( !literal.empty() )
         {
-            const std::chrono::seconds epoch( std::chrono::duration_cast<std::chrono::seconds>( line.timeStamp().time_since_epoch() ) );
-            std::snprintf( value, sizeof(value), format.c_str(), epoch.count() );
+            program_.push_back( op{Literal, literal, conversion(), std::string::npos, 0} );
+            literal.clear();
         }
 
-        else if ( std::string::npos != name.find( "%thread" ) )
-            std::snprintf( value, sizeof(value), format.c_str(), line.threadId() );
+        op o{type, std::string(), conversion(), std::string::npos, 0};
 
-        else if ( std::string::npos != name.find( "%levelnum" ) )
-            std::snprintf( value, sizeof(value), format.c_str(), line.level() );
+        pos += len;
 
-        else if ( std::string::npos != name.find( "%level" ) )
+        // look for formatting override
+        if (( pos < pattern.size() ) && ( '{' == pattern[pos] ))
         {
-            std::string temp( logLevel::toString( line.level() ) );
-            std::snprintf( value, sizeof(value), format.c_str(), temp.c_str() );
+            const std::string_view::size_type end( pattern.find( '}', pos ) );
+
+            if ( std::string_view::npos != end )
+            {
+                o.text = pattern.substr( pos + 1, end - pos - 1 );
+                pos = end + 1;
+            }
         }
 
-        else if ( std::string::npos != name.find( "%module" ) )
-            std::snprintf( value, sizeof(value), format.c_str(), line.moduleName().c_str() );
+        const bool numeric(( EpochMs == type ) || ( Epoch == type ) || ( Thread == type ) || ( LevelNum == type ) || ( LineNum == type ));
 
-        else if ( std::string::npos != name.find( "%class" ) )
-            std::snprintf( value, sizeof(value), format.c_str(), line.className().c_str() );
+        const bool date(( Date == type ) || ( UtcDate == type ));
 
-        else if ( std::string::npos != name.find( "%method" ) )
-            std::snprintf( value, sizeof(value), format.c_str(), line.classFunction().c_str() );
+        // default format
+        if ( o.text.empty() )
+        {
+            if ( date )
+                o.text = DEFAULT_DATE_FORMAT;
+            else if ( EpochMs == type )
+                o.text = DEFAULT_LARGE_NUMBER_FORMAT;
+            else if ( numeric )
+                o.text = DEFAULT_NUMBER_FORMAT;
+            else
+                o.text = DEFAULT_STRING_FORMAT;
+        }
 
-        else if ( std::string::npos != name.find( "%message" ) )
+        if ( date )
         {
-            const size_t len( std::snprintf( nullptr, 0, format.c_str(), line.text().c_str() ) );
+            if ( "ISO8601" == o.text )
+                o.text = (( UtcDate == type ) ? ISO8601_UTC_DATE_FORMAT : ISO8601_DATE_FORMAT );
 
-            if ( len <= sizeof(value) )
-                std::snprintf( value, sizeof(value), format.c_str(), line.text().c_str() );
-            else
-            {
-                valuep = new char[len];
-                std::snprintf( valuep, len, format.c_str(), line.text().c_str() );
-            }
+            o.millis = o.text.find( "%L" );
+            o.id = ++lastId;
         }
+        else
+            o.conv = parseConversion( o.text, numeric );
 
-        else if ( std::string::npos != name.find( "%file" ) )
-            std::snprintf( value, sizeof(value), format.c_str(), line.sourceFilename().c_str() );
+        program_.push_back( o );
+    }
 
-        else if ( std::string::npos != name.find( "%linenum" ) )
-            std::snprintf( value, sizeof(value), format.c_str(), line.sourceLine() );
+    if ( !literal.empty() )
+        program_.push_back( op{Literal, literal, conversion(), std::string::npos, 0} );
+}
 
-        else if ( std::string::npos != name.find( "%newline" ) )
-        {
-            std::stringstream temp;
-            temp << std::endl;
+///////////////////////////////////////////////////////////////////////////////////////////////////
+patternLayout::conversion patternLayout::parseConversion( const std::string& format, bool numeric )
+{
+    conversion result{false, false, false, 0, -1, (int) (CHAR_BIT * sizeof(int)), 0};
 
-            std::snprintf( value, sizeof(value), format.c_str(), temp.str().c_str() );
-        }
+    std::string::size_type i( 1 );
+
+    if (( format.size() < 2 ) || ( '%' != format[0] ))
+        return result;
 
-        // replace format with formatted string
-        std::string::size_type pos;
+    // flags
+    for ( ; i < format.size(); ++i )
+    {
+        if ( '-' == format[i] )
+            result.left = true;
+        else if ( '0' == format[i] )
+            result.zero = true;
+        else if (( '+' == format[i] ) || ( ' ' == format[i] ) || ( '#' == format[i] ))
+            return result;
+        else
+            break;
+    }
 
-        while ( std::string::npos != (pos = result.find( name )) )
-            result.replace( pos, name.size(), valuep ? valuep : value );
+    // width
+    for ( ; ( i < format.size() ) && ( std::isdigit( (unsigned char) format[i] ) ); ++i )
+        result.width = 10 * result.width + (format[i] - '0');
 
-        if ( valuep )
-            delete [] valuep;
+    // precision
+    if (( i < format.size() ) && ( '.' == format[i] ))
+    {
+        result.precision = 0;
+
+        for ( ++i; ( i < format.size() ) && ( std::isdigit( (unsigned char) format[i] ) ); ++i )
+            result.precision = 10 * result.precision + (format[i] - '0');
     }
 
+    // length
+    if ( 0 == format.compare( i, 2, "hh" ) )
+        result.bits = CHAR_BIT * sizeof(char), i += 2;
+    else if ( 0 == format.compare( i, 2, "ll" ) )
+        result.bits = CHAR_BIT * sizeof(long long), i += 2;
+    else if ( 0 == format.compare( i, 1, "h" ) )
+        result.bits = CHAR_BIT * sizeof(short), i += 1;
+    else if ( 0 == format.compare( i, 1, "l" ) )
+        result.bits = CHAR_BIT * sizeof(long), i += 1;
+    else if (( 0 == format.compare( i, 1, "z" ) ) || ( 0 == format.compare( i, 1, "j" ) ))
+        result.bits = CHAR_BIT * sizeof(std::size_t), i += 1;
+
+    // type, must end the format
+    if ( i + 1 != format.size() )
+        return result;
+
+    result.type = format[i];
+
+    if ( numeric )
+        result.simple = ( std::string_view::npos != std::string_view( "diuxXo" ).find( result.type ) );
+    else
+        result.simple = (( 's' == result.type ) && ( !result.zero ) && ( (int) (CHAR_BIT * sizeof(int)) == result.bits ));
+
     return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
-bool patternLayout::findFormat( const std::string& line, std::string& name, std::string& format ) const
+void patternLayout::appendOp( std::string& out, const op& o, const logRecord& record )
 {
-    std::string::size_type pos( std::string::npos );
+    switch ( o.type )
+    {
+    case Literal:
+        out.append( o.text );
+        break;
+
+    case Date:
+    case UtcDate:
+        appendDate( out, o, record );
+        break;
+
+    case EpochMs:
+        appendNumber( out, o, std::chrono::duration_cast<std::chrono::milliseconds>( record.timeStamp().time_since_epoch() ).count() );
+        break;
+
+    case Epoch:
+        appendNumber( out, o, std::chrono::duration_cast<std::chrono::seconds>( record.timeStamp().time_since_epoch() ).count() );
+        break;
+
+    case Thread:
+        appendNumber( out, o, record.threadId() );
+        break;
+
+    case LevelNum:
+        appendNumber( out, o, (int) record.level() );
+        break;
+
+    case Level:
+        appendString( out, o, logLevel::toString( record.level() ) );
+        break;
+
+    case Module:
+        appendString( out, o, record.moduleName() );
+        break;
+
+    case Class:
+        appendString( out, o, record.className() );
+        break;
+
+    case Method:
+        appendString( out, o, record.classFunction() );
+        break;
+
+    case Message:
+        appendString( out, o, record.text() );
+        break;
+
+    case File:
+        appendString( out, o, record.sourceFilename() );
+        break;
+
+    case LineNum:
+        appendNumber( out, o, record.sourceLine() );
+        break;
+
+    case NewLine:
+        appendString( out, o, "\n" );
+        break;
+    }
+}
 
-    format.clear();
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void patternLayout::appendDate( std::string& out, const op& o, const logRecord& record )
+{
+    const long long stamp( std::chrono::duration_cast<std::chrono::milliseconds>( record.timeStamp().time_since_epoch() ).count() );
 
-    // loop through each format, find match
-    for ( stringList::const_iterator i = formats_.begin(); i != formats_.end(); ++i )
-        if ( std::string::npos != (pos = line.find( *i )) )
+    // round down, times before the epoch still have positive milliseconds
+    long long second( stamp / 1000 );
+
+    if ( stamp % 1000 < 0 )
+        --second;
+
+    const int ms( (int) (stamp - second * 1000) );
+
+    renderedDate& d( findRendered( o.id ) );
+
+    // render new second
+    if (( o.id != d.id ) || ( second != d.second ))
+    {
+        tm value{};
+
+        if ( UtcDate == o.type )
+            utcTime( second, value );
+        else
+            localTime( second, value );
+
+        char temp[4096];
+
+        d.id = o.id;
+        d.second = second;
+
+        if ( std::string::npos == o.millis )
         {
-            name = *i;
-            break;
+            d.text.assign( temp, std::strftime( temp, sizeof( temp ), o.text.c_str(), &value ) );
+            d.millis = std::string::npos;
         }
+        else
+        {
+            // placeholder for milliseconds between the two halves
+            d.text.assign( temp, std::strftime( temp, sizeof( temp ), o.text.substr( 0, o.millis ).c_str(), &value ) );
+            d.millis = d.text.size();
+            d.text.append( "000" );
+            d.text.append( temp, std::strftime( temp, sizeof( temp ), o.text.substr( o.millis + 2 ).c_str(), &value ) );
+        }
+    }
+
+    const std::string::size_type pos( out.size() );
 
-    if ( std::string::npos == pos )
-        return false;
+    out.append( d.text );
 
-    try
+    if ( std::string::npos != d.millis )
     {
-        std::string::size_type nameLength( name.length() );
+        out[pos + d.millis] = (char) ('0' + ms / 100);
+        out[pos + d.millis + 1] = (char) ('0' + ms / 10 % 10);
+        out[pos + d.millis + 2] = (char) ('0' + ms % 10);
+    }
+}
 
-        // look for formatting override
-        if ( "{" == line.substr( pos + nameLength, 1 ) )
-        {
-            std::string::size_type end;
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void patternLayout::appendInteger( std::string& out, const conversion& c, unsigned long long value )
+{
+    const unsigned long long mask(( c.bits < 64 ) ? (1ULL << c.bits) - 1 : ~0ULL );
 
-            // found!
-            if ( std::string::npos != (end = line.find( "}", pos )) )
-            {
-                name = line.substr( pos, end - pos + 1 );
-                format = name.substr( nameLength + 1, name.length() - nameLength - 2 );
-            }
-        }
+    // truncate like printf would read the argument
+    unsigned long long magnitude( value & mask );
+    bool negative( false );
+
+    if ((( 'd' == c.type ) || ( 'i' == c.type )) && ( magnitude & (1ULL << (c.bits - 1)) ))
+    {
+        negative = true;
+        magnitude = ((~magnitude) & mask) + 1;
     }
-    catch ( const std::out_of_range& /*ex*/ )
+
+    int base( 10 );
+
+    if (( 'x' == c.type ) || ( 'X' == c.type ))
+        base = 16;
+    else if ( 'o' == c.type )
+        base = 8;
+
+    char digits[72];
+    char *last( digits );
+
+    // zero precision prints nothing for zero
+    if (( magnitude ) || ( 0 != c.precision ))
+        last = std::to_chars( digits, digits + sizeof(digits), magnitude, base ).ptr;
+
+    if ( 'X' == c.type )
     {
-        // this exception is okay, no formatting present...
+        for ( char *p = digits; p != last; ++p )
+            *p = (char) std::toupper( (unsigned char) *p );
     }
 
-    return true;
+    const std::size_t count( last - digits );
+    const std::size_t zeros(( 0 <= c.precision ) && ( count < (std::size_t) c.precision ) ? c.precision - count : 0 );
+    const std::size_t len( (negative ? 1 : 0) + zeros + count );
+
+    // zero flag pads between sign and digits, unless precision given
+    const bool zeroPad(( c.zero ) && ( !c.left ) && ( c.precision < 0 ));
+
+    if (( !c.left ) && ( !zeroPad ))
+        appendPadding( out, c, len, ' ' );
+
+    if ( negative )
+        out.push_back( '-' );
+
+    if ( zeroPad )
+        appendPadding( out, c, len, '0' );
+
+    out.append( zeros, '0' );
+    out.append( digits, count );
+
+    if ( c.left )
+        appendPadding( out, c, len, ' ' );
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
-} // namespace clio
+void patternLayout::appendText( std::string& out, const conversion& c, std::string_view value )
+{
+    // precision truncates strings
+    if (( 0 <= c.precision ) && ( (std::size_t) c.precision < value.size() ))
+        value = value.substr( 0, c.precision );
 
+    if ( !c.left )
+        appendPadding( out, c, value.size(), ' ' );
 
+    out.append( value );
 
+    if ( c.left )
+        appendPadding( out, c, value.size(), ' ' );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void patternLayout::appendPadding( std::string& out, const conversion& c, std::size_t len, char fill )
+{
+    if ( len < (std::size_t) c.width )
+        out.append( c.width - len, fill );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+template <class T>
+void patternLayout::appendNumber( std::string& out, const op& o, T value )
+{
+    if ( o.conv.simple )
+        appendInteger( out, o.conv, (unsigned long long) value );
+    else
+        appendPrintf( out, o.text, value );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void patternLayout::appendString( std::string& out, const op& o, std::string_view value )
+{
+    if ( o.conv.simple )
+        appendText( out, o.conv, value );
+    else
+        appendPrintf( out, o.text, std::string( value ).c_str() );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+template <class T>
+void patternLayout::appendPrintf( std::string& out, const std::string& format, T value )
+{
+    char temp[4096];
+    const int len( std::snprintf( temp, sizeof(temp), format.c_str(), value ) );
+
+    if ( len < 0 )
+        return;
+
+    if ( (std::size_t) len < sizeof(temp) )
+    {
+        out.append( temp, len );
+        return;
+    }
+
+    // too big for the stack
+    const std::string::size_type pos( out.size() );
+
+    out.resize( pos + len + 1 );
+    std::snprintf( &out[pos], len + 1, format.c_str(), value );
+    out.resize( pos + len );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace clio
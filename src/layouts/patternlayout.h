@@ -27,14 +27,16 @@
 
 #include "../layout.h"
 
-#include <list>
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <vector>
 
 /// Clio namespace.
 namespace clio
 {
 
-class logLine;
+class logRecord;
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -45,6 +47,7 @@ class logLine;
  *
  * List of possible values:
  * @arg %date - current date/time
+ * @arg %utcdate - current date/time in UTC
  * @arg %epoch - current date/time in unix epoch format
  * @arg %epochms - current date/time in unix epoch format (milliseconds)
  * @arg %thread - thread number
@@ -58,10 +61,18 @@ class logLine;
  * @arg %linenum - source file line number
  * @arg %newline - new line
  *
+ * Each value may be followed by a printf style sub-format in braces, i.e. %class{%-15.15s}, or
+ * a strftime style one for %date and %utcdate where %L is milliseconds. The sub-format ISO8601
+ * gives i.e. 2026-10-16T12:10:55.178-0400, or 2026-10-16T16:10:55.178Z in UTC.
+ *
  * Some example formats:
  * %date{%m/%d/%Y %H:%M:%S.%L} [%thread{%08x},%levelnum] %class{%-15.15s} %method{%-15.15s} %message%newline
  * %date{%Y%m%d %H%M%S%L} %level{%-5.5s} %message
  * %message (%module,%file,%linenum)%newline
+ *
+ * The pattern is compiled when set, formatting a record then runs through it once appending each
+ * value. Text of the values themselves, like a message containing "%level", is never expanded.
+ * Dates are rendered once per second by each thread and only the milliseconds change per record.
  */
 class patternLayout : public layout
 {
@@ -70,6 +81,9 @@ class patternLayout : public layout
 
 public:
 
+    /// Layout type, as named in config files.
+    static constexpr const char *TYPE = "patternLayout";
+
     /// Conversion pattern property.
     static constexpr const char *PROP_CONVERSIONPATTERN = "conversionPattern";
 
@@ -103,27 +117,130 @@ public:
     // Methods
     // ========================================================================
 
-    /// Format a log line into string form suitable for output.
+    /// Format a log record into string form suitable for output.
+    /**
+     * @param[in] record  log record
+     * @return  formatted log record
+     */
+    virtual std::string format( const logRecord& record ) const;
+
+    /// Format a log record, appending it to a buffer.
+    /**
+     * @param[in] record  log record
+     * @param[in,out] out  buffer to append formatted log record to
+     */
+    virtual void formatTo( const logRecord& record, std::string& out ) const;
+
+    /// Format a log record into pieces, referencing large message text.
+    /**
+     * @param[in] record  log record
+     * @param[in,out] out  line to append formatted log record to
+     */
+    virtual void formatTo( const logRecord& record, lineSegments& out ) const;
+
+protected:
+
+    // ========================================================================
+    // Methods
+    // ========================================================================
+
+    /// Property was set.
     /**
-     * @param[in] line  log line
-     * @return  formatted log line
+     * @param[in] name  property name
      */
-    virtual std::string format( const logLine& line ) const;
+    virtual void propertyChanged( const std::string& name );
 
 private:
 
     static constexpr const char *DEFAULT_DATE_FORMAT = "%m/%d/%Y %H:%M:%S.%L";
+    static constexpr const char *ISO8601_DATE_FORMAT = "%Y-%m-%dT%H:%M:%S.%L%z";
+    static constexpr const char *ISO8601_UTC_DATE_FORMAT = "%Y-%m-%dT%H:%M:%S.%LZ";
     static constexpr const char *DEFAULT_LARGE_NUMBER_FORMAT = "%lld";
     static constexpr const char *DEFAULT_NUMBER_FORMAT = "%d";
     static constexpr const char *DEFAULT_STRING_FORMAT = "%s";
 
-    typedef std::list<std::string> stringList;
-    stringList formats_;
+    /// Operation types.
+    enum opType
+    {
+        Literal,
+        Date,
+        UtcDate,
+        EpochMs,
+        Epoch,
+        Thread,
+        LevelNum,
+        Level,
+        Module,
+        Class,
+        Method,
+        Message,
+        File,
+        LineNum,
+        NewLine,
+    };
+
+    /// Printf style conversion.
+    /**
+     * Sub-formats made of a single conversion with only '-' and '0' flags are applied directly,
+     * anything else is handed to snprintf.
+     */
+    struct conversion
+    {
+        bool simple;            ///< Applied without snprintf.
+        bool left;              ///< Left align.
+        bool zero;              ///< Pad numbers with zeros.
+        int width;              ///< Minimum width.
+        int precision;          ///< Precision, or -1 for default.
+        int bits;               ///< Size of integer argument (in bits).
+        char type;              ///< Conversion type.
+    };
+
+    /// Compiled operation.
+    struct op
+    {
+        opType type;                        ///< Operation type.
+        std::string text;                   ///< Literal text, or sub-format.
+        conversion conv;                    ///< Parsed sub-format.
+        std::string::size_type millis;      ///< Position of "%L" in date sub-format.
+        std::uint64_t id;                   ///< Unique date id, keys rendered dates.
+    };
+
+    typedef std::vector<op> program;
+    program program_;
 
     // ========================================================================
 
-    /// Find format in string.
-    bool findFormat( const std::string& line, std::string& name, std::string& format ) const;
+    /// Compile pattern into operations.
+    void compile( std::string_view pattern );
+
+    /// Parse printf style sub-format.
+    static conversion parseConversion( const std::string& format, bool numeric );
+
+    /// Append value of operation.
+    static void appendOp( std::string& out, const op& o, const logRecord& record );
+
+    /// Append date.
+    static void appendDate( std::string& out, const op& o, const logRecord& record );
+
+    /// Append integer.
+    static void appendInteger( std::string& out, const conversion& c, unsigned long long value );
+
+    /// Append text.
+    static void appendText( std::string& out, const conversion& c, std::string_view value );
+
+    /// Append padding.
+    static void appendPadding( std::string& out, const conversion& c, std::size_t len, char fill );
+
+    /// Append number.
+    template <class T>
+    static void appendNumber( std::string& out, const op& o, T value );
+
+    /// Append string.
+    static void appendString( std::string& out, const op& o, std::string_view value );
+
+    /// Append value with snprintf.
+    template <class T>
+    static void appendPrintf( std::string& out, const std::string& format, T value );
 
 };
 
@@ -27,8 +27,13 @@
 #endif
 
 #include "appender.h"
+#include "epoch.h"
+#include "layout.h"
 #include "logger.h"
 #include "logline.h"
+#include "logrecord.h"
+
+#include <vector>
 
 /// Clio namespace.
 namespace clio
@@ -36,13 +41,18 @@ namespace clio
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 logger::logger() :
-    level_( logLevel::Disabled )
+    level_( logLevel::Disabled ),
+    fanOut_( new fanOut{appenderWeakPtrList(), appenderPtrList(), targetList(), 0} )
 {
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 logger::~logger()
 {
+    delete fanOut_.load( std::memory_order_acquire );
+
+    for ( const fanOut *i: stale_ )
+        delete i;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -53,31 +63,42 @@ void logger::setLevel( logLevel::type value )
     else if ( logLevel::Everything < value )
         value = logLevel::Everything;
 
-    level_ = value;
+    level_.store( value, std::memory_order_relaxed );
+
+    // let log lines at this level past the macros, lowered again on next configuration
+    int max( logRecord::maxLevel_.load( std::memory_order_relaxed ) );
+
+    while (( max < value ) && ( !logRecord::maxLevel_.compare_exchange_weak( max, value, std::memory_order_relaxed ) ))
+        ;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 appenderWeakPtrList logger::appenders() const
 {
-#if HAVE_CXX17 || HAVE_CXX14
-    std::shared_lock<mutex> lock( m_ );
-#else
-    std::lock_guard<mutex> lock( m_ );
-#endif
+    epoch::guard guard;
 
-    return appenders_;
+    return fanOut_.load( std::memory_order_acquire )->appenders;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 void logger::setAppenders( const appenderWeakPtrList& value )
 {
-#if HAVE_CXX17 || HAVE_CXX14
-    std::unique_lock<mutex> lock( m_ );
-#else
-    std::lock_guard<mutex> lock( m_ );
-#endif
+    fanOut *next( new fanOut{value, appenderPtrList(), targetList(), 0} );
+    groupTargets( *next );
+
+    std::lock_guard<std::mutex> lock( m_ );
+
+    const fanOut *prev( fanOut_.exchange( next, std::memory_order_acq_rel ) );
+
+    // lines in flight may still be writing to the previous appenders
+    epoch::synchronize();
+
+    delete prev;
 
-    appenders_ = value;
+    for ( const fanOut *i: stale_ )
+        delete i;
+
+    stale_.clear();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -89,22 +110,184 @@ bool logger::enabled( logLevel::type value ) const
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 void logger::writeLine( const logLine& line )
+{
+    writeLine( line.record() );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void logger::writeLine( const logRecord& record )
 {
     // check if enabled
-    if ( !enabled( line.level() ) )
+    if ( !enabled( record.level() ) )
         return;
 
-    appenderWeakPtrList apps( appenders() );
+    // appenders being replaced are kept until we are done
+    epoch::guard guard;
+
+    const fanOut *out( fanOut_.load( std::memory_order_acquire ) );
+
+    if ( out->targets.empty() )
+        return;
+
+    // lines formatted for each group, appenders writing may log themselves so only reuse when idle
+    struct formatted
+    {
+        std::vector<appender::sharedLine> lines;
+        bool busy = false;
+    };
+
+    static thread_local formatted local;
+
+    formatted temp;
+    formatted& f( local.busy ? temp : local );
+
+    // released even when an appender throws
+    struct claim
+    {
+        explicit claim( bool& value ) : busy( value ) {busy = true;}
+        ~claim() {busy = false;}
+
+        bool& busy;
+    };
+
+    claim hold( f.busy );
+
+    if ( f.lines.size() < (std::size_t) out->groups )
+        f.lines.resize( out->groups );
+
+    for ( int i = 0; i < out->groups; ++i )
+        f.lines[i].formatted = false;
+
+    // withdrawn even when an appender throws
+    struct withdraw
+    {
+        ~withdraw() {appender::offered().app = nullptr;}
+    };
+
+    withdraw pending;
+
+    bool changed( false );
 
     // write to each appender
-    for ( const auto& i: apps )
+    for ( const target& t: out->targets )
+    {
+        appender *app( t.app );
+        const layout *l( app->format() );
+
+        if (( t.group < 0 ) || ( !l ))
+        {
+            app->writeLine( record );
+            continue;
+        }
+
+        // layout changed since grouping, may no longer format like the others
+        if (( l != t.format ) || ( l->version() != t.version ))
+        {
+            changed = true;
+
+            app->writeLine( record );
+            continue;
+        }
+
+        // offer the line of the group, formatted by the first appender writing it
+        appender::offered() = {app, &f.lines[t.group]};
+
+        app->writeLine( record );
+    }
+
+    if ( changed )
+        regroup( out );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void logger::groupTargets( fanOut& value )
+{
+    targetList& result( value.targets );
+    std::vector<const layout*> layouts;
+    std::vector<int> members;
+
+    value.groups = 0;
+
+    for ( const appenderWeakPtr& i: value.appenders )
     {
-        // lock appender for use
-        const auto app( i.lock() );
+        const appenderPtr app( i.lock() );
+
+        if ( !app )
+            continue;
 
-        if ( app )
-            app->writeLine( line );
+        value.owned.push_back( app );
+
+        const layout *l( app->format() );
+
+        int group( -1 );
+
+        // find equivalent layout, appenders without one write the record text as is
+        if ( l )
+        {
+            for ( std::size_t n = 0; ( n < layouts.size() ) && ( group < 0 ); ++n )
+            {
+                if ( l->equivalent( *layouts[n] ) )
+                    group = (int) n;
+            }
+
+            if ( group < 0 )
+            {
+                group = (int) layouts.size();
+
+                layouts.push_back( l );
+                members.push_back( 0 );
+            }
+
+            ++members[group];
+        }
+
+        result.push_back( {app.get(), group, l, l ? l->version() : 0} );
     }
+
+    // renumber groups, nothing to share for appenders alone in theirs
+    std::vector<int> number( layouts.size(), -1 );
+
+    for ( target& t: result )
+    {
+        if (( t.group < 0 ) || ( members[t.group] < 2 ))
+            t.group = -1;
+        else
+        {
+            if ( number[t.group] < 0 )
+                number[t.group] = value.groups++;
+
+            t.group = number[t.group];
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void logger::regroup( const fanOut *value )
+{
+    std::unique_lock<std::mutex> lock( m_, std::try_to_lock );
+
+    // another thread is at it, or the appender list was replaced meanwhile
+    if (( !lock.owns_lock() ) || ( fanOut_.load( std::memory_order_relaxed ) != value ))
+        return;
+
+    fanOut *next( new fanOut{value->appenders, appenderPtrList(), targetList(), 0} );
+    groupTargets( *next );
+
+    fanOut_.store( next, std::memory_order_release );
+
+    // lines may still be writing to it, we cannot wait for them here as we may be one of them
+    stale_.push_back( value );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void logger::resetAppenders( const appenderWeakPtrList& value )
+{
+    fanOut *next( new fanOut{value, appenderPtrList(), targetList(), 0} );
+    groupTargets( *next );
+
+    std::lock_guard<std::mutex> lock( m_ );
+
+    stale_.push_back( fanOut_.exchange( next, std::memory_order_acq_rel ) );
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
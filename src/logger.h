@@ -28,26 +28,26 @@
 #include "appender.h"
 #include "loglevel.h"
 
+#include <atomic>
 #include <map>
 #include <memory>
-
-#if HAVE_SHARED_MUTEX
-#include <shared_mutex>
-#else
 #include <mutex>
-#endif
+#include <vector>
 
 /// Clio namespace.
 namespace clio
 {
 
 class logLine;
+class logRecord;
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// Logger class.
 class logger
 {
+    friend class loggerManager;
+
     typedef logger _Myt;
 
 public:
@@ -70,7 +70,7 @@ public:
     /**
      * @return  log level
      */
-    virtual logLevel::type level() const {return level_;}
+    virtual logLevel::type level() const {return level_.load( std::memory_order_relaxed );}
 
     /// Set log level.
     /**
@@ -86,6 +86,11 @@ public:
 
     /// Set appender list.
     /**
+     * Appenders with equivalent layouts share one formatted line per record. Appenders are
+     * grouped again when a layout is replaced or its properties are set. The logger keeps the
+     * appenders alive until the list is replaced, lines still being written to the previous list
+     * finish before this returns.
+     *
      * @param[in] value  appender list
      */
     virtual void setAppenders( const appenderWeakPtrList& value );
@@ -103,25 +108,63 @@ public:
 
     /// Write the log line to the logger.
     /**
+     * Writes the record of the line. Loggers override writeLine( const logRecord& ) instead.
+     *
      * @param[in] line  log line
      */
-    virtual void writeLine( const logLine& line );
+    virtual void writeLine( const logLine& line ) final;
+
+    /// Write the log record to the logger.
+    /**
+     * @param[in] record  log record
+     */
+    virtual void writeLine( const logRecord& record );
 
 private:
 
-#if HAVE_CXX17
-    typedef std::shared_mutex mutex;
-#elif HAVE_CXX14
-    typedef std::shared_timed_mutex mutex;
-#else
-    typedef std::mutex mutex;
-#endif
+    /// Appender to write to.
+    struct target
+    {
+        appender *app;                              ///< Appender.
+        int group;                                  ///< Group of equivalent layouts, or -1.
+        const layout *format;                       ///< Layout when grouped.
+        unsigned int version;                       ///< Layout version when grouped.
+    };
+
+    typedef std::vector<target> targetList;
+
+    /// Appenders written to, never changed once published.
+    struct fanOut
+    {
+        appenderWeakPtrList appenders;              ///< Appender list as set.
+        appenderPtrList owned;                      ///< Keeps targets alive.
+        targetList targets;                         ///< Appenders to write to, in order.
+        int groups;                                 ///< Number of groups.
+    };
+
+    std::mutex m_;
 
-    mutable mutex m_;
+    std::atomic<logLevel::type> level_;
+    std::atomic<const fanOut*> fanOut_;
+    std::vector<const fanOut*> stale_;
 
-    logLevel::type level_;
 
-    appenderWeakPtrList appenders_;
+    // ========================================================================
+
+    /// Group appenders by equivalent layouts.
+    static void groupTargets( fanOut& value );
+
+    /// Group appenders again after a layout changed.
+    void regroup( const fanOut *value );
+
+    /// Set appender list without waiting for lines in flight.
+    /**
+     * For loggers not reachable yet, or dropped from a configuration whose publishing waits for
+     * all lines. The previous list is freed with the logger.
+     *
+     * @param[in] value  appender list
+     */
+    void resetAppenders( const appenderWeakPtrList& value );
 
 };
 
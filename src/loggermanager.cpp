@@ -28,27 +28,51 @@
 
 #include "appender.h"
 #include "appenderfactory.h"
+#include "callsite.h"
+#include "epoch.h"
+#include "filter.h"
+#include "filterfactory.h"
 #include "layout.h"
 #include "layoutfactory.h"
 #include "logger.h"
 #include "loggermanager.h"
+#include "logrecord.h"
 #include "tinyxml2.h"
 
+#include <algorithm>
+
 #include <sys/stat.h>
 
+#if HAVE_SYS_INOTIFY_H
+#include <cerrno>
+#include <cstdint>
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
 /// Clio namespace.
 namespace clio
 {
 
 loggerManagerPtr loggerManager::instance_( nullptr );
+std::atomic<loggerManager*> loggerManager::current_( nullptr );
 std::mutex loggerManager::instanceMutex_;
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 loggerManager::loggerManager() :
     refreshInterval_( DEFAULT_REFRESH_INTERVAL ),
-    monitorThread_( [this] {monitorConfiguration();} ),
-    rootLogger_( new logger() )
+    config_( new configuration() ),
+    stopping_( false ),
+    wakeFd_( -1 )
 {
+    for ( lookupCounts& c: counts_ )
+    {
+        c.hits.store( 0, std::memory_order_relaxed );
+        c.misses.store( 0, std::memory_order_relaxed );
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -61,43 +85,141 @@ loggerManager::~loggerManager()
         std::lock_guard<mutex> lock( m_ );
 #endif
 
-        // exit monitor thread
+        // exit monitor thread, checked under the lock so it cannot be missed
+        stopping_ = true;
         stopMonitoring_.notify_all();
-
-        // cleanup
-        cleanup();
     }
 
+    wakeMonitor();
+
     // wait for monitor thread to terminate
-    monitorThread_.join();
+    if ( monitorThread_.joinable() )
+        monitorThread_.join();
+
+#if HAVE_SYS_INOTIFY_H
+    if ( 0 <= wakeFd_ )
+        ::close( wakeFd_ );
+#endif
+
+    // cleanup
+    {
+#if HAVE_CXX17 || HAVE_CXX14
+        std::unique_lock<mutex> lock( m_ );
+#else
+        std::lock_guard<mutex> lock( m_ );
+#endif
+
+        publish( new configuration() );
+    }
+
+    delete config_.load( std::memory_order_acquire );
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 loggerWeakPtr loggerManager::find( const std::string& name ) const
 {
-#if HAVE_CXX17 || HAVE_CXX14
-    std::shared_lock<mutex> lock( m_ );
-#else
-    std::lock_guard<mutex> lock( m_ );
-#endif
+    epoch::guard guard;
 
-    // default to root logger
-    loggerPtr log( rootLogger_ );
+    bool hit;
+    const loggerPtr& log( config_.load( std::memory_order_acquire )->find( name, hit ) );
+
+    count( hit );
+    return log;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+logger *loggerManager::lookup( const std::string& name ) const
+{
+    epoch::guard guard;
+
+    bool hit;
+    const loggerPtr& log( config_.load( std::memory_order_acquire )->find( name, hit ) );
+
+    count( hit );
+    return log.get();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+std::uint64_t loggerManager::cacheHits() const
+{
+    std::uint64_t result( 0 );
+
+    for ( const lookupCounts& c: counts_ )
+        result += c.hits.load( std::memory_order_relaxed );
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+std::uint64_t loggerManager::cacheMisses() const
+{
+    std::uint64_t result( 0 );
+
+    for ( const lookupCounts& c: counts_ )
+        result += c.misses.load( std::memory_order_relaxed );
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+loggerManager::configuration::configuration() :
+    rootLogger( new logger() ),
+    cache( new std::atomic<const cachedName*>[CACHE_SLOTS] ),
+    cached( 0 )
+{
+    for ( std::size_t i = 0; i < CACHE_SLOTS; ++i )
+        cache[i].store( nullptr, std::memory_order_relaxed );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+loggerManager::configuration::~configuration()
+{
+    for ( std::size_t i = 0; i < CACHE_SLOTS; ++i )
+        delete cache[i].load( std::memory_order_relaxed );
+}
 
-    // look for specific logger
-    for ( const auto& i: loggers_ )
+///////////////////////////////////////////////////////////////////////////////////////////////////
+const loggerPtr& loggerManager::configuration::find( const std::string& name, bool& hit ) const
+{
+    const std::size_t hash( std::hash<std::string>()( name ) );
+    std::size_t slot( hash & ( CACHE_SLOTS - 1 ) );
+    std::size_t probes( 0 );
+
+    // check names looked up before
+    for ( ; probes < CACHE_PROBES; ++probes, slot = ( slot + 1 ) & ( CACHE_SLOTS - 1 ) )
     {
-        std::string loggerName( i.first );
+        const cachedName *c( cache[slot].load( std::memory_order_acquire ) );
 
-        // compare names... logger name may have wildcards!
-        if ( wildCompare( loggerName.c_str(), name.c_str() ) )
-        {
-            // found one!
-            log = i.second;
+        if ( !c )
             break;
+
+        if (( hash == c->hash ) && ( name == c->name ))
+        {
+            hit = true;
+            return *c->log;
         }
     }
 
+    hit = false;
+
+    // look for most specific logger, names may have wildcards!
+    const loggerPtr *found( matcher.match( name ) );
+
+    // default to root logger
+    const loggerPtr& log( found ? *found : rootLogger );
+
+    // remember unless crowded, another thread may take the slot first
+    if (( probes < CACHE_PROBES ) && ( cached.load( std::memory_order_relaxed ) < CACHE_SLOTS / 2 ))
+    {
+        const cachedName *expected( nullptr );
+        cachedName *c( new cachedName{name, hash, &log} );
+
+        if ( cache[slot].compare_exchange_strong( expected, c, std::memory_order_release, std::memory_order_relaxed ) )
+            cached.fetch_add( 1, std::memory_order_relaxed );
+        else
+            delete c;
+    }
+
     return log;
 }
 
@@ -120,35 +242,73 @@ bool loggerManager::configure( const std::string& filename )
         configFile_ = filename;
         configFileModifiedTime_ = fileModifiedTime( configFile_ );
         configFileSize_ = fileSize( configFile_ );
+
+        // watch new file
+        startMonitoring();
+        wakeMonitor();
+
         return true;
     }
 
     return false;
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool loggerManager::configure( const configBuilder& config )
+{
+    tinyxml2::XMLDocument doc;
+    doc.InsertEndChild( createElement( doc, config.document() ) );
+
+#if HAVE_CXX17 || HAVE_CXX14
+    std::unique_lock<mutex> lock( m_ );
+#else
+    std::lock_guard<mutex> lock( m_ );
+#endif
+
+    if ( !setConfiguration( &doc ) )
+        return false;
+
+    // stop following config file, if any
+    configFile_.clear();
+    wakeMonitor();
+
+    return true;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 loggerManagerPtr loggerManager::instance()
 {
-    if ( !instance_ )
+    if ( !current_.load( std::memory_order_acquire ) )
     {
         std::lock_guard<std::mutex> guard( instanceMutex_ );
 
         if ( !instance_ )
+        {
             instance_.reset( new loggerManager() );
+            current_.store( instance_.get(), std::memory_order_release );
+        }
     }
 
     return instance_;
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+loggerManager *loggerManager::current()
+{
+    loggerManager *result( current_.load( std::memory_order_acquire ) );
+
+    return ( result ? result : instance().get() );
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 void loggerManager::terminate()
 {
-    if ( instance_ )
+    if ( current_.load( std::memory_order_acquire ) )
     {
         std::lock_guard<std::mutex> guard( instanceMutex_ );
 
-        if ( instance_ )
-            instance_.reset();
+        current_.store( nullptr, std::memory_order_release );
+        instance_.reset();
     }
 }
 
@@ -158,8 +318,10 @@ void loggerManager::terminate()
  * Generic property creation.
  */
 template <class T>
-void loggerManager::createProperty( tinyxml2::XMLElement *prop, T *obj )
+void loggerManager::createProperty( tinyxml2::XMLElement *prop, T *obj, configuration& config )
 {
+    (void) config;
+
     if ( !prop->Name() )
         return;
 
@@ -170,7 +332,7 @@ void loggerManager::createProperty( tinyxml2::XMLElement *prop, T *obj )
  * Specialization for appender property creation.
  */
 template <>
-void loggerManager::createProperty( tinyxml2::XMLElement *prop, appender *obj )
+void loggerManager::createProperty( tinyxml2::XMLElement *prop, appender *obj, configuration& config )
 {
     if ( !prop->Name() )
         return;
@@ -188,10 +350,34 @@ void loggerManager::createProperty( tinyxml2::XMLElement *prop, appender *obj )
 
             // process properties
             for ( tinyxml2::XMLElement *lprop = prop->FirstChildElement(); lprop; lprop = lprop->NextSiblingElement() )
-                createProperty( lprop, l );
+                createProperty( lprop, l, config );
+        }
+    }
+
+    // check for filter
+    else if ( "filter" == propName )
+    {
+        filter *f( filterFactory::create( prop->Attribute( "type" ) ? prop->Attribute( "type" ) : "" ) );
+
+        if ( f )
+        {
+            obj->addFilter( f );
+
+            // process properties
+            for ( tinyxml2::XMLElement *fprop = prop->FirstChildElement(); fprop; fprop = fprop->NextSiblingElement() )
+                createProperty( fprop, f, config );
         }
     }
 
+    // check for appender-ref, only appenders defined before this one can be referenced
+    else if (( "appender-ref" == propName ) && ( prop->GetText() ))
+    {
+        appenderPtrMap::iterator i( config.appenders.find( prop->GetText() ) );
+
+        if (( config.appenders.end() != i ) && ( i->second.get() != obj ))
+            obj->attach( i->second );
+    }
+
     // normal property
     else
     {
@@ -203,52 +389,61 @@ void loggerManager::createProperty( tinyxml2::XMLElement *prop, appender *obj )
  * Specialization for logger property creation.
  */
 template <>
-void loggerManager::createProperty( tinyxml2::XMLElement *prop, logger *obj )
+void loggerManager::createProperty( tinyxml2::XMLElement *prop, logger *obj, configuration& config )
 {
+    (void) config;
+
     if (( !prop->Name() ) || ( !prop->GetText() ))
         return;
 
     std::string propName( prop->Name() );
     std::string propValue( prop->GetText() );
 
-    // check for level
+    // check for level, appender-ref is collected by createLogger()
     if ( "level" == propName )
         obj->setLevel( logLevel::fromString( propValue ) );
-
-    // check for appender-ref
-    else if ( "appender-ref" == propName )
-    {
-        appenderPtrMap::iterator i( appenders_.find( propValue ) );
-
-        // add appender to logger appender list
-        if ( appenders_.end() != i )
-        {
-            appenderWeakPtrList temp( obj->appenders() );
-            temp.push_back( i->second );
-
-            obj->setAppenders( temp );
-        }
-    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
-void loggerManager::createAppender( tinyxml2::XMLElement *app )
+void loggerManager::createAppender( tinyxml2::XMLElement *app, configuration& config, const configuration& prev )
 {
     const char* name( app->Attribute( "name" ) );
     const char* type( app->Attribute( "type" ) );
 
     if (( name ) && ( type ))
     {
+        const std::string xml( toString( app ) );
+
+        // keep appender open when neither it nor appenders it writes to changed
+        const appenderPtrMap::const_iterator i( prev.appenders.find( name ) );
+
+        if (( prev.appenders.end() != i ) && ( xml == prev.appenderSpecs.at( name ) ) && ( sameRefs( app, config, prev ) ))
+        {
+            if ( config.appenders.insert( *i ).second )
+            {
+                config.appenderOrder.push_front( i->second );
+                config.appenderSpecs[name] = xml;
+            }
+
+            return;
+        }
+
         appender *a( appenderFactory::create( type ) );
 
         if ( !a )
             return;
 
-        appenders_.insert( appenderPtrMap::value_type( name, appenderPtr( a ) ) );
+        const appenderPtr ptr( a );
+
+        if ( !config.appenders.insert( appenderPtrMap::value_type( name, ptr ) ).second )
+            return;
+
+        config.appenderOrder.push_front( ptr );
+        config.appenderSpecs[name] = xml;
 
         // process properties
         for ( tinyxml2::XMLElement *prop = app->FirstChildElement(); prop; prop = prop->NextSiblingElement() )
-            createProperty( prop, a );
+            createProperty( prop, a, config );
 
         // open appender
         a->open();
@@ -256,37 +451,138 @@ void loggerManager::createAppender( tinyxml2::XMLElement *app )
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
-void loggerManager::createLogger( tinyxml2::XMLElement *log, bool isRoot )
+void loggerManager::createLogger( tinyxml2::XMLElement *log, configuration& config, const configuration& prev, bool isRoot )
 {
     const char* name( log->Attribute( "name" ) );
 
     if (( isRoot ) || (( !isRoot ) && ( name )))
     {
+        const std::string xml( toString( log ) );
+
+        // keep logger when neither it nor its appenders changed, call sites may still hold it
+        if ( sameRefs( log, config, prev ) )
+        {
+            if (( isRoot ) && ( xml == prev.rootSpec ))
+            {
+                config.rootLogger = prev.rootLogger;
+                config.rootSpec = xml;
+                return;
+            }
+
+            const loggerPtrMap::const_iterator i( isRoot ? prev.loggers.end() : prev.loggers.find( name ) );
+
+            if (( prev.loggers.end() != i ) && ( xml == prev.loggerSpecs.at( name ) ))
+            {
+                if ( config.loggers.insert( *i ).second )
+                    config.loggerSpecs[name] = xml;
+
+                return;
+            }
+        }
+
         logger *l( new logger() );
 
         if ( isRoot )
-            rootLogger_.reset( l );
-        else
         {
-            loggers_.insert( loggerPtrMap::value_type( name, loggerPtr( l ) ) );
+            config.rootLogger.reset( l );
+            config.rootSpec = xml;
         }
+        else if ( config.loggers.insert( loggerPtrMap::value_type( name, loggerPtr( l ) ) ).second )
+            config.loggerSpecs[name] = xml;
+
+        // process properties, collecting appenders to set them at once
+        appenderWeakPtrList appenders;
 
-        // process properties
         for ( tinyxml2::XMLElement *prop = log->FirstChildElement(); prop; prop = prop->NextSiblingElement() )
-            createProperty( prop, l );
+        {
+            if (( prop->Name() ) && ( prop->GetText() ) && ( std::string( "appender-ref" ) == prop->Name() ))
+            {
+                const appenderPtrMap::const_iterator i( config.appenders.find( prop->GetText() ) );
+
+                if ( config.appenders.end() != i )
+                    appenders.push_back( i->second );
+            }
+            else
+                createProperty( prop, l, config );
+        }
+
+        // not published yet, no lines to wait for
+        l->resetAppenders( appenders );
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void loggerManager::count( bool hit ) const
+{
+    // threads take turns picking a shard, so they rarely write the same cache line
+    static std::atomic<unsigned int> next( 0 );
+    static thread_local const unsigned int shard( next.fetch_add( 1, std::memory_order_relaxed ) % COUNT_SHARDS );
+
+    std::atomic<std::uint64_t>& counter( hit ? counts_[shard].hits : counts_[shard].misses );
+    counter.fetch_add( 1, std::memory_order_relaxed );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void loggerManager::publish( configuration *config )
+{
+    const configuration *prev( config_.exchange( config, std::memory_order_acq_rel ) );
+
+    // force call sites to lookup their logger again
+    callSite::invalidate();
+
+    // let log lines know what could be enabled
+    updateMaxLevel( *config );
+
+    detach( *prev, *config );
+
+    // wait for lines still writing to the previous configuration
+    epoch::synchronize();
+
+    retire( prev, *config );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void loggerManager::detach( const configuration& config, const configuration& next )
+{
+    // the appenders of loggers not taken over are about to be closed, publish() waits for lines
+    // still writing to them
+    for ( const auto& i: config.loggers )
+    {
+        const loggerPtrMap::const_iterator n( next.loggers.find( i.first ) );
+
+        if (( next.loggers.end() == n ) || ( n->second != i.second ))
+            i.second->resetAppenders( appenderWeakPtrList() );
+    }
+
+    if ( next.rootLogger != config.rootLogger )
+        config.rootLogger->resetAppenders( appenderWeakPtrList() );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void loggerManager::retire( const configuration *config, const configuration& next )
+{
+    // close newest first, appenders passing records on are closed before the ones they write to
+    for ( const auto& i: config->appenderOrder )
+    {
+        if ( next.appenderOrder.end() == std::find( next.appenderOrder.begin(), next.appenderOrder.end(), i ) )
+            i->close();
     }
+
+    // frees loggers not taken over, call sites were invalidated and publish() waited for log
+    // statements still using them, log lines built by hand hold on to their own
+    delete config;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
-void loggerManager::cleanup()
+void loggerManager::updateMaxLevel( const configuration& config )
 {
-    loggers_.clear();
-    rootLogger_.reset( new logger() );
+    int level( config.rootLogger->level() );
 
-    for ( auto& i: appenders_ )
-        i.second->close();
+    for ( const auto& i: config.loggers )
+        if ( level < i.second->level() )
+            level = i.second->level();
 
-    appenders_.clear();
+    logRecord::maxLevel_.store( level, std::memory_order_relaxed );
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -309,22 +605,33 @@ bool loggerManager::setConfiguration( tinyxml2::XMLDocument *doc )
 
     if ( root )
     {
-        // remove existing loggers and appenders
-        cleanup();
+        // build next configuration while lines are still written to the current one, taking over
+        // whatever did not change
+        const configuration& prev( *config_.load( std::memory_order_acquire ) );
+        configuration *config( new configuration() );
 
         // setup appenders
         for ( tinyxml2::XMLElement *app = root->FirstChildElement( "appender" ); app; app = app->NextSiblingElement( "appender" ) )
-            createAppender( app );
+            createAppender( app, *config, prev );
 
         // setup root logger
         tinyxml2::XMLElement *rootLog = root->FirstChildElement( "root" );
 
         if ( rootLog )
-            createLogger( rootLog, true );
+            createLogger( rootLog, *config, prev, true );
+        else if ( prev.rootSpec.empty() )
+            config->rootLogger = prev.rootLogger;
 
         // setup loggers
         for ( tinyxml2::XMLElement *log = root->FirstChildElement( "logger" ); log; log = log->NextSiblingElement( "logger" ) )
-            createLogger( log );
+            createLogger( log, *config, prev );
+
+        // compile names for lookup
+        for ( const auto& i: config->loggers )
+            config->matcher.add( i.first, i.second );
+
+        // replace existing loggers and appenders
+        publish( config );
 
         return true;
     }
@@ -351,77 +658,214 @@ void loggerManager::setRefreshIntervalImpl( const clock_type::duration& interval
     refreshInterval_ = interval;
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void loggerManager::startMonitoring()
+{
+    if ( monitorThread_.joinable() )
+        return;
+
+#if HAVE_SYS_INOTIFY_H
+    wakeFd_ = ::eventfd( 0, EFD_CLOEXEC | EFD_NONBLOCK );
+#endif
+
+    monitorThread_ = std::thread( [this] {monitorConfiguration();} );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void loggerManager::wakeMonitor()
+{
+#if HAVE_SYS_INOTIFY_H
+    if ( wakeFd_ < 0 )
+        return;
+
+    const std::uint64_t one( 1 );
+    const ssize_t result( ::write( wakeFd_, &one, sizeof(one) ) );
+    (void) result;
+#endif
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 void loggerManager::monitorConfiguration()
 {
+#if HAVE_SYS_INOTIFY_H
+    if ( watchConfiguration() )
+        return;
+#endif
+
+    // nothing to watch with, check every so often
+    pollConfiguration();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void loggerManager::pollConfiguration()
+{
+    for ( ;; )
+    {
+        std::string filename;
+
+        {
 #if HAVE_CXX17 || HAVE_CXX14
-    std::shared_lock<mutex> lock( m_ );
+            std::shared_lock<mutex> lock( m_ );
 #else
-    std::unique_lock<mutex> lock( m_ );
+            std::unique_lock<mutex> lock( m_ );
 #endif
 
-    clock_type::duration duration;
+            if ( stopMonitoring_.wait_for( lock, refreshInterval_, [this] {return stopping_;} ) )
+                return;
+
+            filename = configFile_;
+        }
+
+        reloadIfChanged( filename );
+    }
+}
 
-    do
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool loggerManager::watchConfiguration()
+{
+#if HAVE_SYS_INOTIFY_H
+    if ( wakeFd_ < 0 )
+        return false;
+
+    const int fd( ::inotify_init1( IN_NONBLOCK | IN_CLOEXEC ) );
+
+    if ( fd < 0 )
+        return false;
+
+    std::string filename;
+    std::string name;
+    int wd( -1 );
+    bool changed( false );
+    std::chrono::steady_clock::time_point due;
+
+    for ( ;; )
     {
-        if ( configFile_.length() )
+        // follow configuration file, configure() may have switched to another one
         {
-            // get modified time and size
-            const file_time mt( fileModifiedTime( configFile_ ) );
-            const std::uintmax_t s( fileSize( configFile_ ) );
+#if HAVE_CXX17 || HAVE_CXX14
+            std::shared_lock<mutex> lock( m_ );
+#else
+            std::unique_lock<mutex> lock( m_ );
+#endif
 
-            // check against previous
-            if (( configFileModifiedTime_ != mt ) || ( configFileSize_ != s ))
+            if ( stopping_ )
+                break;
+
+            if ( filename != configFile_ )
             {
-#if HAVE_CXX17 || HAVE_CXX14
-                // upgrade our lock
-                // why doesn't std c++ support this natively? this code looks awful...
-                lock.unlock();
+                filename = configFile_;
+                changed = false;
 
-                {
-                    std::unique_lock<mutex> lockUpgrade( m_ );
-#endif
+                if ( 0 <= wd )
+                    ::inotify_rm_watch( fd, wd );
 
-                    setConfiguration( configFile_ );
-                    configFileModifiedTime_ = mt;
-                    configFileSize_ = s;
+                wd = -1;
 
-#if HAVE_CXX17 || HAVE_CXX14
+                // configured without a file, nothing to watch until configured with one again
+                if ( !filename.empty() )
+                {
+                    // editors often save by renaming another file over ours, so watch the directory
+                    const std::size_t slash( filename.rfind( '/' ) );
+                    const std::string dir( ( std::string::npos == slash ) ? std::string( "." ) : filename.substr( 0, slash + 1 ) );
+                    name = ( std::string::npos == slash ) ? filename : filename.substr( slash + 1 );
+
+                    // not IN_MODIFY, log files sharing the directory would wake us on every write
+                    wd = ::inotify_add_watch( fd, dir.c_str(), IN_CLOSE_WRITE | IN_ATTRIB | IN_CREATE | IN_MOVED_TO );
+
+                    // cannot watch, poll instead
+                    if ( wd < 0 )
+                    {
+                        ::close( fd );
+                        return false;
+                    }
                 }
+            }
+        }
 
-                lock.lock();
-#endif
+        // once changed, wait for the file to settle before reloading
+        int timeout( -1 );
+
+        if ( changed )
+        {
+            const std::chrono::steady_clock::duration left( due - std::chrono::steady_clock::now() );
+
+            if ( left <= std::chrono::steady_clock::duration::zero() )
+            {
+                changed = false;
+                reloadIfChanged( filename );
+                continue;
             }
+
+            timeout = (int) std::chrono::ceil<std::chrono::milliseconds>( left ).count();
+        }
+
+        struct pollfd fds[2] = {{fd, POLLIN, 0}, {wakeFd_, POLLIN, 0}};
+
+        if (( ::poll( fds, 2, timeout ) < 0 ) && ( EINTR != errno ))
+        {
+            ::close( fd );
+            return false;
         }
 
-        duration = refreshInterval_;
+        if ( fds[1].revents & POLLIN )
+        {
+            std::uint64_t count;
+            const ssize_t n( ::read( wakeFd_, &count, sizeof(count) ) );
+            (void) n;
+        }
+
+        if ( fds[0].revents & POLLIN )
+        {
+            alignas(struct inotify_event) char buffer[4096];
+            ssize_t n;
+
+            while ( 0 < ( n = ::read( fd, buffer, sizeof(buffer) ) ) )
+            {
+                for ( char *p = buffer; p < buffer + n; )
+                {
+                    const struct inotify_event *event( reinterpret_cast<const struct inotify_event*>( p ) );
+
+                    // events were lost, check anyway
+                    if (( event->mask & IN_Q_OVERFLOW ) || (( event->len ) && ( name == event->name )))
+                    {
+                        changed = true;
+                        due = std::chrono::steady_clock::now() + SETTLE_INTERVAL;
+                    }
+
+                    p += sizeof(struct inotify_event) + event->len;
+                }
+            }
+        }
+    }
 
-    } while ( std::cv_status::timeout == stopMonitoring_.wait_for( lock, duration ) );
+    ::close( fd );
+#endif
+
+    return true;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
-bool loggerManager::wildCompare( const char *wild, const char *s )
+void loggerManager::reloadIfChanged( const std::string& filename )
 {
-    // if we reach at the end of both strings, we are done
-    if (( *wild == '\0' ) && ( *s == '\0' ))
-        return true;
- 
-    // make sure that the characters after '*' are present in second string. This function assumes
-    // that the first string will not contain two consecutive '*'
-    if (( *wild == '*' ) && ( *(wild+1) != '\0' ) && ( *s == '\0'))
-        return false;
- 
-    // if the first string contains '?', or current characters of both strings match
-    if (( *wild == '?' ) || ( *wild == *s ))
-        return wildCompare( wild+1, s+1 );
- 
-    // if there is *, then there are two possibilities
-    // a) we consider current character of second string
-    // b) we ignore current character of second string
-    if ( *wild == '*' ) 
-        return wildCompare( wild+1, s ) || wildCompare( wild, s+1 );
+    if ( filename.empty() )
+        return;
+
+    // get modified time and size without holding up configure()
+    const file_time mt( fileModifiedTime( filename ) );
+    const std::uintmax_t s( fileSize( filename ) );
+
+    std::lock_guard<mutex> lock( m_ );
+
+    // check against previous, unless configured with another file meanwhile
+    if (( stopping_ ) || ( filename != configFile_ ))
+        return;
 
-    return false; 
+    if (( configFileModifiedTime_ != mt ) || ( configFileSize_ != s ))
+    {
+        setConfiguration( configFile_ );
+        configFileModifiedTime_ = mt;
+        configFileSize_ = s;
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -460,5 +904,52 @@ std::uintmax_t loggerManager::fileSize( const std::string& filename )
 #endif
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+std::string loggerManager::toString( tinyxml2::XMLElement *e )
+{
+    tinyxml2::XMLPrinter printer( nullptr, true );
+    e->Accept( &printer );
+
+    return std::string( printer.CStr() );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool loggerManager::sameRefs( tinyxml2::XMLElement *e, const configuration& config, const configuration& prev )
+{
+    for ( tinyxml2::XMLElement *ref = e->FirstChildElement( "appender-ref" ); ref; ref = ref->NextSiblingElement( "appender-ref" ) )
+    {
+        if ( !ref->GetText() )
+            continue;
+
+        const appenderPtrMap::const_iterator i( config.appenders.find( ref->GetText() ) );
+        const appenderPtrMap::const_iterator j( prev.appenders.find( ref->GetText() ) );
+
+        const appender *a( ( config.appenders.end() == i ) ? nullptr : i->second.get() );
+        const appender *b( ( prev.appenders.end() == j ) ? nullptr : j->second.get() );
+
+        if ( a != b )
+            return false;
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+tinyxml2::XMLElement *loggerManager::createElement( tinyxml2::XMLDocument& doc, const configBuilder::element& e )
+{
+    tinyxml2::XMLElement *result( doc.NewElement( e.name.c_str() ) );
+
+    for ( const auto& i: e.attributes )
+        result->SetAttribute( i.first.c_str(), i.second.c_str() );
+
+    if ( !e.text.empty() )
+        result->SetText( e.text.c_str() );
+
+    for ( const configBuilder::element& i: e.children )
+        result->InsertEndChild( createElement( doc, i ) );
+
+    return result;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 } // namespace clio
@@ -26,12 +26,17 @@
 #define LOGGERMANAGER_H
 
 #include "appender.h"
+#include "configbuilder.h"
 #include "loggermanager.h"
 #include "logger.h"
+#include "namematcher.h"
 
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <ctime>
+#include <map>
 #include <memory>
 #include <string>
 #include <thread>
@@ -64,6 +69,16 @@ typedef std::shared_ptr<loggerManager> loggerManagerPtr;
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// Logger manager class.
+/**
+ * Loggers and appenders are published as one configuration that is never changed afterwards.
+ * Looking up a logger reads the current configuration without taking a lock. Names already looked
+ * up are answered from a cache kept with the configuration, so they are matched against logger
+ * name patterns once per configuration. Reconfiguring builds a new one, swaps it in, waits for
+ * lines still using the old one and then closes its appenders.
+ *
+ * Appenders and loggers whose XML and referenced appenders are unchanged are taken over by the new
+ * configuration as they are. Their files stay open and only what changed is created or closed.
+ */
 class loggerManager
 {
     typedef loggerManager _Myt;
@@ -85,11 +100,34 @@ public:
 
     /// Retrieve named logger.
     /**
+     * Logger names may have '*' and '?' wildcards. A logger named exactly @p name wins, otherwise
+     * the one with the longest name before its first wildcard, see @c nameMatcher. The root logger
+     * is returned when none match.
      * @param[in] name  name of logger
      * @return  pointer to logger
      */
     loggerWeakPtr find( const std::string& name ) const;
 
+    /// Retrieve named logger without taking a reference.
+    /**
+     * Loggers are kept alive until the manager is terminated, even when no longer configured.
+     * @param[in] name  name of logger
+     * @return  pointer to logger
+     */
+    logger *lookup( const std::string& name ) const;
+
+    /// Retrieve number of lookups answered from the name cache.
+    /**
+     * @return  cache hit count
+     */
+    std::uint64_t cacheHits() const;
+
+    /// Retrieve number of lookups matched against logger names.
+    /**
+     * @return  cache miss count
+     */
+    std::uint64_t cacheMisses() const;
+
     /// Retrieve logger refresh interval.
     /**
      * @return  refresh interval
@@ -98,7 +136,9 @@ public:
 
     /// Set logger refresh interval.
     /**
-     * Sets how often the configuration file is checked for modifications and reload.
+     * Sets how often the configuration file is checked for modifications and reload. Where the
+     * file can be watched for changes (inotify on Linux) it is reloaded shortly after it changes
+     * instead and the interval is not used.
      * @param[in] value  refresh interval
      */
     template <class Rep, class Period>
@@ -110,11 +150,20 @@ public:
 
     /// Configure logger based on config file.
     /**
+     * The first successful call starts monitoring the file for changes.
      * @param[in] filename  config filename
      * @return  @c true on success, @c false otherwise
      */
     bool configure( const std::string& filename );
 
+    /// Configure logger based on description built in code.
+    /**
+     * Loaded the same way as a config file. A config file configured before is no longer monitored.
+     * @param[in] config  configuration description
+     * @return  @c true on success, @c false otherwise
+     */
+    bool configure( const configBuilder& config );
+
     // ========================================================================
     // Static Methods
     // ========================================================================
@@ -125,6 +174,12 @@ public:
      */
     static loggerManagerPtr instance();
 
+    /// Returns pointer to instance without taking a reference.
+    /**
+     * @return  pointer to @c loggerManager object, valid until terminated
+     */
+    static loggerManager *current();
+
     /// Terminate instance.
     static void terminate();
 
@@ -145,6 +200,13 @@ private:
 
     static constexpr std::chrono::seconds DEFAULT_REFRESH_INTERVAL = std::chrono::seconds( 5 );
 
+    /// How long a watched file must stay unchanged before reloading, editors may save in steps.
+    static constexpr std::chrono::milliseconds SETTLE_INTERVAL = std::chrono::milliseconds( 200 );
+
+    static const std::size_t CACHE_SLOTS = 4096;    ///< Name cache size, power of two.
+    static const std::size_t CACHE_PROBES = 8;      ///< Slots tried before giving up.
+    static const std::size_t COUNT_SHARDS = 16;     ///< Cache counters, spread over threads.
+
 #if HAVE_CXX17
     typedef std::shared_mutex mutex;
     typedef std::condition_variable_any condition_variable;
@@ -159,6 +221,47 @@ private:
     typedef std::time_t file_time;
 #endif
 
+    /// Logger found for a name.
+    struct cachedName
+    {
+        std::string name;                           ///< name looked up
+        std::size_t hash;                           ///< hash of name
+        const loggerPtr *log;                       ///< logger found
+    };
+
+    /// Loggers and appenders of one configuration.
+    struct configuration
+    {
+        appenderPtrMap appenders;                   ///< appenders by name
+        appenderPtrList appenderOrder;              ///< appenders, newest first
+        std::map<std::string, std::string> appenderSpecs;   ///< appender xml by name
+
+        loggerPtrMap loggers;                       ///< loggers by name
+        nameMatcher<loggerPtr> matcher;             ///< loggers by name pattern
+        loggerPtr rootLogger;                       ///< root logger
+        std::map<std::string, std::string> loggerSpecs;     ///< logger xml by name
+        std::string rootSpec;                       ///< root logger xml
+
+        std::unique_ptr<std::atomic<const cachedName*>[]> cache;  ///< names looked up so far
+        mutable std::atomic<std::size_t> cached;    ///< names in cache
+
+        /// Constructor.
+        configuration();
+
+        /// Destructor.
+        ~configuration();
+
+        /// Retrieve logger for name.
+        const loggerPtr& find( const std::string& name, bool& hit ) const;
+    };
+
+    /// Cache counters.
+    struct alignas(64) lookupCounts
+    {
+        std::atomic<std::uint64_t> hits;            ///< lookups answered by cache
+        std::atomic<std::uint64_t> misses;          ///< lookups matched against names
+    };
+
     mutable mutex m_;
 
     std::string configFile_;
@@ -167,15 +270,17 @@ private:
 
     clock_type::duration refreshInterval_;
 
-    std::thread monitorThread_;
-    condition_variable stopMonitoring_;
+    std::atomic<const configuration*> config_;
 
-    appenderPtrMap appenders_;
+    mutable lookupCounts counts_[COUNT_SHARDS];
 
-    loggerPtrMap loggers_;
-    loggerPtr rootLogger_;
+    condition_variable stopMonitoring_;
+    std::thread monitorThread_;
+    bool stopping_;
+    int wakeFd_;
 
     static loggerManagerPtr instance_;
+    static std::atomic<loggerManager*> current_;
     static std::mutex instanceMutex_;
 
     // ========================================================================
@@ -185,16 +290,28 @@ private:
 
     /// Create property from xml.
     template <class T>
-    void createProperty( tinyxml2::XMLElement *prop, T *obj );
+    void createProperty( tinyxml2::XMLElement *prop, T *obj, configuration& config );
+
+    /// Create appender from xml, or take over unchanged one from previous configuration.
+    void createAppender( tinyxml2::XMLElement *app, configuration& config, const configuration& prev );
 
-    /// Create appender from xml.
-    void createAppender( tinyxml2::XMLElement *app );
+    /// Create logger from xml, or take over unchanged one from previous configuration.
+    void createLogger( tinyxml2::XMLElement *log, configuration& config, const configuration& prev, bool isRoot = false );
 
-    /// Create logger from xml.
-    void createLogger( tinyxml2::XMLElement *log, bool isRoot = false );
+    /// Count lookup.
+    void count( bool hit ) const;
 
-    /// Cleanup appenders and loggers.
-    void cleanup();
+    /// Swap in configuration and retire the previous one.
+    void publish( configuration *config );
+
+    /// Clear appenders of loggers not taken over by @p next.
+    void detach( const configuration& config, const configuration& next );
+
+    /// Close appenders and free loggers of configuration no longer in use, except those taken over by @p next.
+    void retire( const configuration *config, const configuration& next );
+
+    /// Publish most verbose level of all loggers.
+    static void updateMaxLevel( const configuration& config );
 
     /// Configure logger based on config file.
     bool setConfiguration( const std::string& filename );
@@ -202,11 +319,23 @@ private:
     /// Configure logger based on XML document.
     bool setConfiguration( tinyxml2::XMLDocument *doc );
 
+    /// Start monitoring configuration file if not already.
+    void startMonitoring();
+
+    /// Wake monitor thread to stop or follow another configuration file.
+    void wakeMonitor();
+
     /// Monitor for log reconfiguration.
     void monitorConfiguration();
 
-    /// Compare string with wildcards to another string.
-    static bool wildCompare( const char *wild, const char *s );
+    /// Check configuration file every refresh interval.
+    void pollConfiguration();
+
+    /// Wait for configuration file to change.
+    bool watchConfiguration();
+
+    /// Reload configuration file if modified.
+    void reloadIfChanged( const std::string& filename );
 
     /// Retrieve file modified time.
     static file_time fileModifiedTime( const std::string& filename );
@@ -214,6 +343,15 @@ private:
     /// Retrieve file size.
     static std::uintmax_t fileSize( const std::string& filename );
 
+    /// Retrieve xml of element, to tell whether it changed.
+    static std::string toString( tinyxml2::XMLElement *e );
+
+    /// Check if appenders referenced by element are the same in both configurations.
+    static bool sameRefs( tinyxml2::XMLElement *e, const configuration& config, const configuration& prev );
+
+    /// Create xml element from description.
+    static tinyxml2::XMLElement *createElement( tinyxml2::XMLDocument& doc, const configBuilder::element& e );
+
 };
 
 template <class Rep, class Period>
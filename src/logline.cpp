@@ -31,7 +31,6 @@
 #include "logline.h"
 
 #include <cstdio>
-#include <stack>
 #include <thread>
 
 /// Clio namespace.
@@ -39,268 +38,216 @@ namespace clio
 {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
-logLine::logLine( logLevel::type level, const char* file, const char* function, unsigned int line ) :
-    level_( level ),
-    sourceFilename_( file ),
-    sourceLine_( line ),
-    stamp_( clock_type::now() ),
-    threadId_( std::hash<std::thread::id>()( std::this_thread::get_id() ) )
+
+/// Call site owned by a log line.
+/**
+ * Used for log lines not created by the LOG_* macros, or whose call site information was changed
+ * after construction.
+ */
+class logLine::ownedSite
 {
-    // set logger name from function
-    setLoggerName( function );
+public:
+
+    /// Constructor.
+    ownedSite( logLevel::type level,
+        std::string_view file,
+        std::string_view moduleName,
+        std::string_view className,
+        std::string_view classFunction,
+        unsigned int line ) :
+        file_( file ),
+        moduleName_( moduleName ),
+        className_( className ),
+        classFunction_( classFunction ),
+        site_( level, file_.c_str(), functionName( moduleName_, className_, classFunction_ ), line )
+    {
+    }
+
+    /// Retrieve call site.
+    const callSite& site() const {return site_;}
+
+private:
+
+    const std::string file_;
+    const std::string moduleName_;
+    const std::string className_;
+    const std::string classFunction_;
+
+    const callSite site_;
+
+};
+
+/// Placeholder call site until the owned one is set.
+static const callSite emptySite( logLevel::Disabled, "", functionName(), 0 );
 
-    if ( level_ < logLevel::Fatal )
-        level_ = logLevel::Fatal;
-    else if ( logLevel::Trace < level_ )
-        level_ = logLevel::Trace;
+///////////////////////////////////////////////////////////////////////////////////////////////////
+logLine::logLine( logLevel::type level, const char* file, const char* function, unsigned int line ) :
+    record_( emptySite, nullptr, validLevel( level ) )
+{
+    const ownedSitePtr site( newOwnedSite( record_.level(), file, functionName( function ), line ) );
+    record_.setSite( site->site(), site );
 
-    // retrieve logger from manager
-    logger_ = loggerManager::instance()->find( loggerName() );
+    // retrieve logger from manager, level may be raised later
+    hold();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
-logLine::logLine( const _Myt& rhs )
+logLine::logLine( callSite& site ) :
+    record_( site )
 {
-    copy( rhs );
+    hold();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
-logLine::~logLine()
+logLine::logLine( const logRecord& record ) :
+    record_( record )
 {
-    loggerPtr line( logger_.lock() );
+    // the record is written by whoever owns it
+    record_.setLog( nullptr );
+}
 
-    // write line to log
-    if( line )
-        line->writeLine( *this );
+///////////////////////////////////////////////////////////////////////////////////////////////////
+logLine::logLine( const _Myt& rhs ) :
+    log_( rhs.log_ ),
+    record_( rhs.record_ )
+{
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
-void logLine::setText( const char *format, ... )
+logLine::~logLine()
 {
-    std::va_list params;
-    va_start( params, format );
+}
 
-    text_.clear();
+///////////////////////////////////////////////////////////////////////////////////////////////////
+logLine& logLine::operator = ( const _Myt& rhs )
+{
+    record_ = rhs.record_;
+    log_ = rhs.log_;
 
-    appendTextV( format, params );
+    return *this;
+}
 
-    va_end( params );
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void logLine::setModuleName( const std::string& value )
+{
+    const callSite& site( record_.site() );
+    setOwnedSite( site.sourceFilename(), value, site.className(), site.classFunction(), site.sourceLine() );
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
-void logLine::setTextHex( const void *buffer, unsigned int bufferLen, unsigned int width )
+void logLine::setClassName( const std::string& value )
 {
-    text_.clear();
+    const callSite& site( record_.site() );
+    setOwnedSite( site.sourceFilename(), site.moduleName(), value, site.classFunction(), site.sourceLine() );
+}
 
-    appendTextHex( buffer, bufferLen, width );
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void logLine::setClassFunction( const std::string& value )
+{
+    const callSite& site( record_.site() );
+    setOwnedSite( site.sourceFilename(), site.moduleName(), site.className(), value, site.sourceLine() );
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
-bool logLine::enabled() const
+void logLine::setSourceFilename( const std::string& value )
 {
-    loggerPtr line( logger_.lock() );
+    const callSite& site( record_.site() );
+    setOwnedSite( value, site.moduleName(), site.className(), site.classFunction(), site.sourceLine() );
+}
 
-    return ( line ? line->enabled( level() ) : false );
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void logLine::setSourceLine( unsigned int value )
+{
+    const callSite& site( record_.site() );
+    setOwnedSite( site.sourceFilename(), site.moduleName(), site.className(), site.classFunction(), value );
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
-void logLine::appendText( const char *format, ... )
+void logLine::setText( const char *format, ... )
 {
     std::va_list params;
     va_start( params, format );
 
-    appendTextV( format, params );
+    record_.textBuffer().clear();
+    record_.appendTextV( format, params );
 
     va_end( params );
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
-void logLine::appendTextHex( const void *buffer, unsigned int bufferLen, unsigned int width )
+void logLine::setTextHex( const void *buffer, unsigned int bufferLen, unsigned int width )
 {
-    // log buffer in hex format
-    if (( buffer ) && ( bufferLen ))
-    {
-        const unsigned char *bufferPtr( (const unsigned char*) buffer );
-
-        std::stringstream os;
-
-        std::string readable;
-        char temp[512];
-
-        if ( width < MIN_WIDTH )
-            width = MIN_WIDTH;
-        else if ( width > MAX_WIDTH )
-            width = MAX_WIDTH;
-
-        os << std::endl;
-
-        for ( unsigned int i = 0; i < bufferLen; ++i )
-        {
-            if ( 0 == (i%width) )
-            {
-                if ( 0 != i )
-                {
-                    os << readable << std::endl;
-                    readable.clear();
-                }
-
-                std::snprintf( temp, sizeof(temp), "    %08X ", i );
-                os << temp;
-            }
-
-            std::snprintf( temp, sizeof(temp), "%02X ", bufferPtr[i] );
-            os << temp;
+    record_.textBuffer().clear();
+    record_.appendTextHex( buffer, bufferLen, width );
+}
 
-            std::snprintf( temp, sizeof(temp), "%c", (' ' <= bufferPtr[i] && bufferPtr[i] <= '~') ? bufferPtr[i] : '.' );
-            readable.append( temp );
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void logLine::appendText( const char *format, ... )
+{
+    std::va_list params;
+    va_start( params, format );
 
-            if ( i == (bufferLen-1) )
-            {
-                while ( 0 != (++i%width) )
-                    os << "   ";
+    record_.appendTextV( format, params );
 
-                os << readable;
-            }
-        }
+    va_end( params );
+}
 
-        text_.append( os.str() );
-    }
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void logLine::appendTextHex( const void *buffer, unsigned int bufferLen, unsigned int width )
+{
+    record_.appendTextHex( buffer, bufferLen, width );
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 std::string logLine::loggerName() const
 {
-    // generate name from properties
-    std::string name;
-
-    if ( !moduleName().empty() )
-    {
-        name.append( moduleName() );
-        name.push_back( '.' );
-    }
-
-    if ( !className().empty() )
-    {
-        name.append( className() );
-        name.push_back( '.' );
-    }
-
-    name.append( classFunction() );
-
-    return name;
+    return callSite::buildLoggerName( record_.moduleName(), record_.className(), record_.classFunction() );
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 void logLine::setLoggerName( const char *function )
 {
-    std::stack<std::string> names;
-    std::string name( function );
-
-    // we are looking for the function name only
-    // for example the string 'void class::foo( int bar )' we want only 'class::foo'
-    std::string::size_type end( name.find( '(' ) );
+    const functionName name( function );
+    const callSite& site( record_.site() );
 
-    if ( std::string::npos != end )
-    {
-        std::string::size_type begin( name.rfind( ' ', end ) );
-
-        // no space is okay, for example CTOR or DTOR
-        if ( std::string::npos == begin )
-            begin = 0;
-
-        std::string temp;
-
-        // swap strings as we will extract what we are interested in
-        temp.swap( name );
-
-        // push to stack everything between the '::'...
-        while ( ++begin < end )
-        {
-            std::string::value_type c( temp.at( begin ) );
-
-            if ( ':' == c )
-            {
-                names.push( name );
-                name.clear();
-
-                ++begin;
-            }
-            else
-            {
-                name.push_back( c );
-            }
-        }
-    }
-
-    // save off name
-    names.push( name );
-
-    // we should have list that looks like this now:
-    // function name
-    // class name
-    // namespace c
-    // namespace b
-    // namespace a
-    //
-    // lets pop off into our variables...
-
-    classFunction_ = names.top();
-    names.pop();
-
-    if ( names.empty() )
-        return;
-
-    className_ = names.top();
-    names.pop();
-
-    if ( names.empty() )
-        return;
-
-    moduleName_ = names.top();
+    setOwnedSite( site.sourceFilename(), name.moduleName(), name.className(), name.classFunction(), site.sourceLine() );
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
-void logLine::copy( const _Myt& rhs )
+void logLine::setOwnedSite( std::string_view file, std::string_view moduleName, std::string_view className, std::string_view classFunction, unsigned int line )
 {
-    level_ = rhs.level_;
-
-    moduleName_ = rhs.moduleName_;
-    className_ = rhs.className_;
-    classFunction_ = rhs.classFunction_;
-
-    sourceFilename_ = rhs.sourceFilename_;
-    sourceLine_ = rhs.sourceLine_;
-
-    text_ = rhs.text_;
+    // values may point into the current owned site, so create the new one before releasing it
+    ownedSitePtr site( newOwnedSite( record_.level(), file, functionName( moduleName, className, classFunction ), line ) );
 
-    stamp_ = rhs.stamp_;
-    threadId_ = rhs.threadId_;
-
-    logger_ = rhs.logger_;
+    const callSite& value( site->site() );
+    record_.setSite( value, std::move( site ) );
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
-void logLine::appendTextV( const char *format, std::va_list params )
+void logLine::hold()
 {
-    char *temp( nullptr );
-
-    // determine how much space to reserve/allocate for string
-    int reserveSize( std::vsnprintf( temp, 0, format, params ) );
+    // the line may outlive the configuration its logger belongs to, the manager frees loggers
+    // it no longer uses
+    log_ = loggerManager::current()->find( loggerName() ).lock();
+    record_.setLog( log_.get() );
+}
 
-    if ( 0 < reserveSize )
-    {
-        // allocate string
-        temp = new char[reserveSize];
+///////////////////////////////////////////////////////////////////////////////////////////////////
+logLine::ownedSitePtr logLine::newOwnedSite( logLevel::type level, std::string_view file, const functionName& function, unsigned int line )
+{
+    return std::make_shared<const ownedSite>( level, file, function.moduleName(), function.className(), function.classFunction(), line );
+}
 
-        // format string
-        std::vsnprintf( temp, reserveSize, format, params );
-        text_.append( temp );
+///////////////////////////////////////////////////////////////////////////////////////////////////
+logLevel::type logLine::validLevel( logLevel::type value )
+{
+    if ( value < logLevel::Fatal )
+        return logLevel::Fatal;
+    else if ( logLevel::Trace < value )
+        return logLevel::Trace;
 
-        // cleanup
-        delete [] temp;
-    }
+    return value;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 } // namespace clio
-
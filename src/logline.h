@@ -25,15 +25,18 @@
 #ifndef LOGLINE_H
 #define LOGLINE_H
 
+#include "callsite.h"
 #include "clioapi.h"
 #include "hexdump.h"
 #include "logger.h"
 #include "loglevel.h"
+#include "logrecord.h"
 
 #include <chrono>
 #include <cstdarg>
+#include <memory>
 #include <string>
-#include <sstream>
+#include <string_view>
 
 #if _WIN32
 #pragma warning( push )
@@ -47,15 +50,19 @@ namespace clio
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// Log line data class.
+/**
+ * Compatibility wrapper around @c logRecord for code that builds log lines by hand. The LOG_*
+ * macros use @c logRecord directly.
+ */
 class CLIO_API logLine
 {
     typedef logLine _Myt;
 
 public:
 
-    typedef std::chrono::system_clock clock_type;   ///< Clock type for time stamps.
+    typedef logRecord::clock_type clock_type;       ///< Clock type for time stamps.
 
-    static const unsigned int DEFAULT_WIDTH = 16;   ///< Default width when logging hex dumps.
+    static const unsigned int DEFAULT_WIDTH = logRecord::DEFAULT_WIDTH;   ///< Default width when logging hex dumps.
 
     // ========================================================================
     // CTOR / DTOR
@@ -73,6 +80,20 @@ public:
         const char *function,
         unsigned int line );
 
+    /// Constructor.
+    /**
+     * @param[in] site  call site of log statement
+     */
+    explicit logLine( callSite& site );
+
+    /// Constructor.
+    /**
+     * Copies a record for code written against log lines, the copy is not written.
+     *
+     * @param[in] record  log record to copy
+     */
+    explicit logLine( const logRecord& record );
+
     /// Constructor.
     /**
      * @param[in] rhs  object to copy
@@ -91,7 +112,7 @@ public:
      * @param[in] rhs  value to assign from
      * @return  reference to @c this
      */
-    _Myt& operator = ( const _Myt& rhs ) {copy( rhs ); return *this;}
+    _Myt& operator = ( const _Myt& rhs );
 
     // ========================================================================
     // Properties
@@ -101,55 +122,55 @@ public:
     /**
      * @return  log level
      */
-    virtual logLevel::type level() const {return level_;}
+    virtual logLevel::type level() const {return record_.level();}
 
     /// Set log level.
     /**
      * @param[in] value  log level
      */
-    virtual void setLevel( logLevel::type value ) {level_ = value;}
+    virtual void setLevel( logLevel::type value ) {record_.setLevel( value );}
 
     /// Retrieve module name.
     /**
      * @return  module/library name
      */
-    virtual std::string moduleName() const {return moduleName_;}
+    virtual std::string moduleName() const {return std::string( record_.moduleName() );}
 
     /// Set module name.
     /**
      * @param[in] value  module/library name
      */
-    virtual void setModuleName( const std::string& value ) {moduleName_ = value;}
+    virtual void setModuleName( const std::string& value );
 
     /// Retrieve class name.
     /**
      * @return  source file class name
      */
-    virtual std::string className() const {return className_;}
+    virtual std::string className() const {return std::string( record_.className() );}
 
     /// Set class name.
     /**
      * @param[in] value  class name
      */
-    virtual void setClassName( const std::string& value ) {className_ = value;}
+    virtual void setClassName( const std::string& value );
 
     /// Retrieve class function.
     /**
      * @return  source file class function name
      */
-    virtual std::string classFunction() const {return classFunction_;}
+    virtual std::string classFunction() const {return std::string( record_.classFunction() );}
 
     /// Set class function name.
     /**
      * @param[in] value  class function name
      */
-    virtual void setClassFunction( const std::string& value ) {classFunction_ = value;}
+    virtual void setClassFunction( const std::string& value );
 
     /// Retrieve source filename.
     /**
      * @return  source file name
      */
-    virtual std::string sourceFilename() const {return sourceFilename_;}
+    virtual std::string sourceFilename() const {return record_.sourceFilename();}
 
     /// Set source filename.
     /**
@@ -157,13 +178,13 @@ public:
      *
      * @param[in] value  source file name
      */
-    virtual void setSourceFilename( const std::string& value ) {sourceFilename_ = value;}
+    virtual void setSourceFilename( const std::string& value );
 
     /// Retrieve source file line number.
     /**
      * @return  source file line
      */
-    virtual unsigned int sourceLine() const {return sourceLine_;}
+    virtual unsigned int sourceLine() const {return record_.sourceLine();}
 
     /// Set source file line number
     /**
@@ -171,19 +192,19 @@ public:
      *
      * @param[in] value  source file line
      */
-    virtual void setSourceLine( unsigned int value ) {sourceLine_ = value;}
+    virtual void setSourceLine( unsigned int value );
 
     /// Retrieve log text line.
     /**
      * @return  log text
      */
-    virtual std::string text() const {return text_;}
+    virtual std::string text() const {return std::string( record_.text() );}
 
     /// Set log text.
     /**
      * @param[in] value  log text
      */
-    virtual void setText( const std::string& value ) {text_ = value;}
+    virtual void setText( const std::string& value ) {record_.textBuffer().assign( value );}
 
     /// Set log text from format.
     /**
@@ -213,7 +234,7 @@ public:
     /**
      * @return  time stamp of log line
      */
-    virtual clock_type::time_point timeStamp() const {return stamp_;}
+    virtual clock_type::time_point timeStamp() const {return record_.timeStamp();}
 
     /// Set log line time stamp.
     /**
@@ -228,19 +249,25 @@ public:
      *
      * @return  thread id
      */
-    virtual std::size_t threadId() const {return threadId_;}
+    virtual std::size_t threadId() const {return record_.threadId();}
 
     /// Set thread id.
     /**
      * @param[in] value  thread id
      */
-    virtual void setThreadId( std::size_t value ) {threadId_ = value;}
+    virtual void setThreadId( std::size_t value ) {record_.setThreadId( value );}
 
     /// Check if log enabled.
     /**
      * @return  @c true if enabled, @c false otherwise
      */
-    virtual bool enabled() const;
+    virtual bool enabled() const {return record_.enabled();}
+
+    /// Retrieve log record.
+    /**
+     * @return  log record
+     */
+    const logRecord& record() const {return record_;}
 
     // ========================================================================
     // Methods
@@ -250,7 +277,7 @@ public:
     /**
      * @param[in] value  log text
      */
-    virtual void appendText( const std::string& value ) {text_.append( value );}
+    virtual void appendText( const std::string& value ) {record_.appendText( value );}
 
     /// Append log text from format.
     /**
@@ -298,36 +325,30 @@ protected:
     /**
      * @param[in] value  time stamp
      */
-    virtual void setTimeStampImpl( const clock_type::time_point& value ) {stamp_ = value;}
+    virtual void setTimeStampImpl( const clock_type::time_point& value ) {record_.setTimeStamp( value );}
 
 private:
 
-    static const unsigned int MIN_WIDTH = 8;
-    static const unsigned int MAX_WIDTH = 64;
+    class ownedSite;
 
-    logLevel::type level_;
+    typedef std::shared_ptr<const ownedSite> ownedSitePtr;
 
-    std::string moduleName_;
-    std::string className_;
-    std::string classFunction_;
+    loggerPtr log_;                                 ///< Keeps logger of record alive.
+    logRecord record_;
 
-    std::string sourceFilename_;
-    unsigned int sourceLine_;
-
-    std::string text_;
-
-    clock_type::time_point stamp_;
-    std::size_t threadId_;
+    // ========================================================================
 
-    loggerWeakPtr logger_;
+    /// Retrieve logger and keep it alive.
+    void hold();
 
-    // ========================================================================
+    /// Set call site owned by this object.
+    void setOwnedSite( std::string_view file, std::string_view moduleName, std::string_view className, std::string_view classFunction, unsigned int line );
 
-    /// Copy object.
-    void copy( const _Myt& rhs );
+    /// Create call site owned by a log line.
+    static ownedSitePtr newOwnedSite( logLevel::type level, std::string_view file, const functionName& function, unsigned int line );
 
-    /// Append text.
-    void appendTextV( const char *format, std::va_list params );
+    /// Clamp log level to a valid value.
+    static logLevel::type validLevel( logLevel::type value );
 
 };
 
@@ -348,10 +369,10 @@ logLine& operator << ( logLine& lhs, const T& rhs )
 {
     if ( lhs.enabled() )
     {
-        std::stringstream os;
-        os << rhs;
+        logRecord::text_type temp;
+        formatter<T>::format( temp, rhs );
 
-        lhs.appendText( os.str() );
+        lhs.appendText( std::string( temp.view() ) );
     }
 
     return lhs;
@@ -0,0 +1,140 @@
+/**
+ * @file logrecord.cpp
+ * @brief Log record class.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "logrecord.h"
+
+#include <cstdio>
+#include <functional>
+#include <thread>
+
+/// Clio namespace.
+namespace clio
+{
+
+std::atomic<int> logRecord::maxLevel_( logLevel::Disabled );
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void logRecord::appendText( const char *format, ... )
+{
+    std::va_list params;
+    va_start( params, format );
+
+    appendTextV( format, params );
+
+    va_end( params );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void logRecord::appendTextV( const char *format, std::va_list params )
+{
+    // arguments are consumed by each pass, keep a copy in case we have to grow
+    std::va_list temp;
+    va_copy( temp, params );
+
+    const std::size_t avail( text_.capacity() - text_.size() );
+
+    // format directly into buffer
+    const int len( std::vsnprintf( text_.prepare( 0 ), avail + 1, format, params ) );
+
+    if ( 0 < len )
+    {
+        // did not fit, grow and format again
+        if ( avail < (std::size_t) len )
+            std::vsnprintf( text_.prepare( len ), len + 1, format, temp );
+
+        text_.commit( len );
+    }
+
+    va_end( temp );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void logRecord::appendTextHex( const void *buffer, unsigned int bufferLen, unsigned int width )
+{
+    static const char digits[] = "0123456789ABCDEF";
+
+    // log buffer in hex format
+    if (( buffer ) && ( bufferLen ))
+    {
+        const unsigned char *bufferPtr( (const unsigned char*) buffer );
+
+        char readable[MAX_WIDTH];
+        unsigned int readableLen( 0 );
+
+        if ( width < MIN_WIDTH )
+            width = MIN_WIDTH;
+        else if ( width > MAX_WIDTH )
+            width = MAX_WIDTH;
+
+        text_.append( '\n' );
+
+        for ( unsigned int i = 0; i < bufferLen; ++i )
+        {
+            if ( 0 == (i%width) )
+            {
+                if ( 0 != i )
+                {
+                    text_.append( readable, readableLen );
+                    text_.append( '\n' );
+                    readableLen = 0;
+                }
+
+                char offset[16];
+                const int len( std::snprintf( offset, sizeof(offset), "    %08X ", i ) );
+                text_.append( offset, len );
+            }
+
+            char *p( text_.prepare( 3 ) );
+            p[0] = digits[bufferPtr[i] >> 4];
+            p[1] = digits[bufferPtr[i] & 0x0f];
+            p[2] = ' ';
+            text_.commit( 3 );
+
+            readable[readableLen++] = (' ' <= bufferPtr[i] && bufferPtr[i] <= '~') ? bufferPtr[i] : '.';
+
+            if ( i == (bufferLen-1) )
+            {
+                while ( 0 != (++i%width) )
+                    text_.append( "   ", 3 );
+
+                text_.append( readable, readableLen );
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+std::size_t logRecord::currentThreadId()
+{
+    // hashing the id is not free, only do it once per thread
+    static thread_local const std::size_t id( std::hash<std::thread::id>()( std::this_thread::get_id() ) );
+    return id;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace clio
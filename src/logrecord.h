@@ -0,0 +1,429 @@
+/**
+ * @file logrecord.h
+ * @brief Log record class.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LOGRECORD_H
+#define LOGRECORD_H
+
+#include "callsite.h"
+#include "clioapi.h"
+#include "formatter.h"
+#include "hexdump.h"
+#include "logger.h"
+#include "loglevel.h"
+#include "textbuffer.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdarg>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#if _WIN32
+#pragma warning( push )
+#pragma warning( disable: 4251 ) // disable warnings about STL interfaces
+#endif
+
+/// Clio namespace.
+namespace clio
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Log record class.
+/**
+ * Compact log line used by the LOG_* macros. Source information is kept by reference to the
+ * static call site and text shorter than TEXT_CAPACITY is stored inline, so building a typical
+ * record does not touch the heap. The record is written to its logger when destroyed.
+ */
+class CLIO_API logRecord
+{
+    friend class logger;
+    friend class loggerManager;
+
+    typedef logRecord _Myt;
+
+public:
+
+    typedef std::chrono::system_clock clock_type;   ///< Clock type for time stamps.
+
+    static const unsigned int DEFAULT_WIDTH = 16;   ///< Default width when logging hex dumps.
+
+    static const std::size_t TEXT_CAPACITY = 240;   ///< Size of inline text storage.
+
+    typedef inlineTextBuffer<TEXT_CAPACITY> text_type; ///< Text buffer type.
+
+    // ========================================================================
+    // CTOR / DTOR
+    // ========================================================================
+
+    /// Constructor.
+    /**
+     * @param[in] site  call site of log statement
+     */
+    explicit logRecord( callSite& site ) :
+        site_( &site ),
+        logger_( site.resolve() ),
+        stamp_( clock_type::now() ),
+        threadId_( currentThreadId() ),
+        level_( site.level() )
+    {
+    }
+
+    /// Constructor.
+    /**
+     * @param[in] site  call site of log statement
+     * @param[in] log  logger to write to
+     * @param[in] level  log level
+     */
+    logRecord( const callSite& site, logger *log, logLevel::type level ) :
+        site_( &site ),
+        logger_( log ),
+        stamp_( clock_type::now() ),
+        threadId_( currentThreadId() ),
+        level_( level )
+    {
+    }
+
+    /// Constructor.
+    /**
+     * @param[in] rhs  object to copy
+     */
+    logRecord( const _Myt& rhs ) = default;
+
+    /// Constructor.
+    /**
+     * Only the new object writes the record, @p rhs is left without a logger.
+     *
+     * @param[in] rhs  object to move
+     */
+    logRecord( _Myt&& rhs ) :
+        site_( rhs.site_ ),
+        siteOwner_( std::move( rhs.siteOwner_ ) ),
+        logger_( rhs.logger_ ),
+        stamp_( rhs.stamp_ ),
+        threadId_( rhs.threadId_ ),
+        level_( rhs.level_ ),
+        text_( std::move( rhs.text_ ) )
+    {
+        rhs.logger_ = nullptr;
+    }
+
+    /// Destructor.
+    ~logRecord()
+    {
+        // write record to log
+        if ( logger_ )
+            logger_->writeLine( *this );
+    }
+
+    // ========================================================================
+    // Operators
+    // ========================================================================
+
+    /// Assignment operator.
+    /**
+     * @param[in] rhs  value to assign from
+     * @return  reference to @c this
+     */
+    _Myt& operator = ( const _Myt& rhs ) = default;
+
+    /// Assignment operator.
+    /**
+     * Only this object writes the record, @p rhs is left without a logger.
+     *
+     * @param[in] rhs  value to move from
+     * @return  reference to @c this
+     */
+    _Myt& operator = ( _Myt&& rhs )
+    {
+        site_ = rhs.site_;
+        siteOwner_ = std::move( rhs.siteOwner_ );
+        logger_ = rhs.logger_;
+        stamp_ = rhs.stamp_;
+        threadId_ = rhs.threadId_;
+        level_ = rhs.level_;
+        text_ = std::move( rhs.text_ );
+
+        rhs.logger_ = nullptr;
+        return *this;
+    }
+
+    // ========================================================================
+    // Properties
+    // ========================================================================
+
+    /// Retrieve call site.
+    /**
+     * @return  call site of log statement
+     */
+    const callSite& site() const {return *site_;}
+
+    /// Set call site.
+    /**
+     * @param[in] value  call site of log statement
+     */
+    void setSite( const callSite& value ) {site_ = &value; siteOwner_.reset();}
+
+    /// Set call site not created by a LOG_* macro.
+    /**
+     * Copies of the record share @p owner, keeping the call site alive for as long as any copy
+     * refers to it.
+     *
+     * @param[in] value  call site of log statement
+     * @param[in] owner  object owning @p value
+     */
+    void setSite( const callSite& value, std::shared_ptr<const void> owner ) {site_ = &value; siteOwner_ = std::move( owner );}
+
+    /// Retrieve logger.
+    /**
+     * @return  pointer to logger, or @c nullptr if none
+     */
+    logger *log() const {return logger_;}
+
+    /// Set logger.
+    /**
+     * @param[in] value  pointer to logger
+     */
+    void setLog( logger *value ) {logger_ = value;}
+
+    /// Retrieve log level.
+    /**
+     * @return  log level
+     */
+    logLevel::type level() const {return level_;}
+
+    /// Set log level.
+    /**
+     * @param[in] value  log level
+     */
+    void setLevel( logLevel::type value ) {level_ = value;}
+
+    /// Retrieve module name.
+    /**
+     * @return  module/library name
+     */
+    std::string_view moduleName() const {return site_->moduleName();}
+
+    /// Retrieve class name.
+    /**
+     * @return  source file class name
+     */
+    std::string_view className() const {return site_->className();}
+
+    /// Retrieve class function.
+    /**
+     * @return  source file class function name
+     */
+    std::string_view classFunction() const {return site_->classFunction();}
+
+    /// Retrieve source filename.
+    /**
+     * @return  source file name
+     */
+    const char *sourceFilename() const {return site_->sourceFilename();}
+
+    /// Retrieve source file line number.
+    /**
+     * @return  source file line
+     */
+    unsigned int sourceLine() const {return site_->sourceLine();}
+
+    /// Retrieve log text.
+    /**
+     * @return  log text
+     */
+    std::string_view text() const {return text_.view();}
+
+    /// Retrieve log text buffer.
+    /**
+     * @return  log text buffer
+     */
+    const text_type& textBuffer() const {return text_;}
+
+    /// Retrieve log text buffer.
+    /**
+     * @return  log text buffer
+     */
+    text_type& textBuffer() {return text_;}
+
+    /// Retrieve time stamp.
+    /**
+     * @return  time stamp of log record
+     */
+    clock_type::time_point timeStamp() const {return stamp_;}
+
+    /// Set time stamp.
+    /**
+     * @param[in] value  time stamp
+     */
+    void setTimeStamp( const clock_type::time_point& value ) {stamp_ = value;}
+
+    /// Get thread id.
+    /**
+     * This is the thread id of who logged the record.
+     *
+     * @return  thread id
+     */
+    std::size_t threadId() const {return threadId_;}
+
+    /// Set thread id.
+    /**
+     * @param[in] value  thread id
+     */
+    void setThreadId( std::size_t value ) {threadId_ = value;}
+
+    /// Check if log enabled.
+    /**
+     * @return  @c true if enabled, @c false otherwise
+     */
+    bool enabled() const {return (( logger_ ) && ( logger_->enabled( level_ ) ));}
+
+    // ========================================================================
+    // Methods
+    // ========================================================================
+
+    /// Append log text.
+    /**
+     * @param[in] value  log text
+     */
+    void appendText( std::string_view value ) {text_.append( value );}
+
+    /// Append log text from format.
+    /**
+     * This function will append text from a "C" style formatted string.
+     *
+     * @param[in] format  format string
+     */
+    void appendText( const char *format, ... );
+
+    /// Append log text from format.
+    /**
+     * @param[in] format  format string
+     * @param[in] params  format arguments
+     */
+    void appendTextV( const char *format, std::va_list params );
+
+    /// Append to the log a hexadecimal string from buffer.
+    /**
+     * This function will write a buffer in hexadecimal to the log text.
+     *
+     * The @p width parameter will control how big the text line is.  For example, using a width
+     * of 8 on a buffer of numbers 0-19 would look like:
+     * 00000000  00 01 02 03 04 05 06 07 08  ........
+     * 00000008  09 0A 0B 0C 0D 0E 0F 10 11  ........
+     * 00000010  12 13 14 15                 ....
+     *
+     * @param[in] buffer  buffer to log out
+     * @param[in] bufferLen  size of buffer
+     * @param[in] width  width of hexadecimal lines to write out.
+     */
+    void appendTextHex( const void *buffer, unsigned int bufferLen, unsigned int width = DEFAULT_WIDTH );
+
+    // ========================================================================
+    // Static Methods
+    // ========================================================================
+
+    /// Check if any logger could be enabled for logLevel @p value.
+    /**
+     * This is a quick check against the most verbose level of any configured logger, used by the
+     * LOG_* macros to skip building a log record that no logger would write.
+     *
+     * @param[in] value  log level
+     * @return  @c true if possibly enabled, @c false otherwise
+     */
+    static bool mayBeEnabled( logLevel::type value ) {return ( value <= maxLevel_.load( std::memory_order_relaxed ) );}
+
+    /// Retrieve id of calling thread.
+    /**
+     * @return  thread id
+     */
+    static std::size_t currentThreadId();
+
+private:
+
+    static const unsigned int MIN_WIDTH = 8;
+    static const unsigned int MAX_WIDTH = 64;
+
+    static std::atomic<int> maxLevel_;
+
+    const callSite *site_;
+    std::shared_ptr<const void> siteOwner_;
+
+    logger *logger_;
+
+    clock_type::time_point stamp_;
+    std::size_t threadId_;
+
+    logLevel::type level_;
+
+    text_type text_;
+
+};
+
+/// Stream insertion operator.
+/**
+ * The value is formatted straight into the record text by @c formatter<T>.
+ *
+ * @param[in,out] lhs  @c logRecord to insert into
+ * @param[in] rhs  value to insert
+ * @return  reference to the @c logRecord object
+ */
+template <class T>
+logRecord& operator << ( logRecord& lhs, const T& rhs )
+{
+    formatter<T>::format( lhs.textBuffer(), rhs );
+    return lhs;
+}
+
+/// Specialization for hex dumps.
+template <>
+inline logRecord& operator << ( logRecord& lhs, const hexDumpInfo& rhs )
+{
+    lhs.appendTextHex( rhs.buffer(), rhs.bufferLen(), rhs.width() );
+    return lhs;
+}
+
+/// Stream insertion operator.
+/**
+ * @param[in,out] lhs  rvalue reference of @c logRecord to insert into
+ * @param[in] rhs  value to insert
+ * @return  modified @c logRecord object
+ */
+template <class T>
+logRecord& operator << ( logRecord&& lhs, const T& rhs )
+{
+    return (lhs << rhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace clio
+
+#if _WIN32
+#pragma warning( pop )
+#endif
+
+#endif // LOGRECORD_H
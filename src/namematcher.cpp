@@ -0,0 +1,136 @@
+/**
+ * @file namematcher.cpp
+ * @brief Compiled logger name patterns.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "namematcher.h"
+
+#include <cstring>
+
+/// Clio namespace.
+namespace clio
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+globPattern::globPattern( std::string_view pattern ) :
+    compiled_( false ),
+    stars_( 0 ),
+    accept_( 0 )
+{
+    // consecutive '*' match the same as one
+    for ( char c: pattern )
+    {
+        if (( '*' != c ) || ( pattern_.empty() ) || ( '*' != pattern_.back() ))
+            pattern_.push_back( c );
+    }
+
+    std::memset( masks_, 0, sizeof(masks_) );
+
+    if ( MAX_STATES < pattern_.size() )
+        return;
+
+    // bit i set when the first i characters of the pattern have been matched
+    for ( std::size_t i = 0; i < pattern_.size(); ++i )
+    {
+        const std::uint64_t bit( std::uint64_t( 1 ) << i );
+
+        if ( '*' == pattern_[i] )
+            stars_ |= bit;
+        else if ( '?' == pattern_[i] )
+        {
+            for ( std::uint64_t& mask: masks_ )
+                mask |= bit;
+        }
+        else
+            masks_[(unsigned char) pattern_[i]] |= bit;
+    }
+
+    accept_ = std::uint64_t( 1 ) << pattern_.size();
+    compiled_ = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool globPattern::matches( std::string_view s ) const
+{
+    if ( !compiled_ )
+        return compare( pattern_, s );
+
+    // a '*' may match nothing, so reaching one also reaches the position after it
+    std::uint64_t states( 1 );
+    states |= ( states & stars_ ) << 1;
+
+    for ( unsigned char c: s )
+    {
+        states = (( states & masks_[c] ) << 1 ) | ( states & stars_ );
+        states |= ( states & stars_ ) << 1;
+
+        if ( !states )
+            return false;
+    }
+
+    return ( 0 != ( states & accept_ ));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool globPattern::compare( std::string_view wild, std::string_view s )
+{
+    std::size_t w( 0 );
+    std::size_t i( 0 );
+
+    std::size_t star( std::string_view::npos );
+    std::size_t mark( 0 );
+
+    while ( i < s.size() )
+    {
+        if (( w < wild.size() ) && ( '*' == wild[w] ))
+        {
+            star = w++;
+            mark = i;
+        }
+        else if (( w < wild.size() ) && (( '?' == wild[w] ) || ( wild[w] == s[i] )))
+        {
+            ++w;
+            ++i;
+        }
+
+        // let the last '*' match one more character
+        else if ( std::string_view::npos != star )
+        {
+            w = star + 1;
+            i = ++mark;
+        }
+        else
+            return false;
+    }
+
+    while (( w < wild.size() ) && ( '*' == wild[w] ))
+        ++w;
+
+    return ( wild.size() == w );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace clio
@@ -0,0 +1,296 @@
+/**
+ * @file namematcher.h
+ * @brief Compiled logger name patterns.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NAMEMATCHER_H
+#define NAMEMATCHER_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// Clio namespace.
+namespace clio
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Compiled glob pattern class.
+/**
+ * A '*' matches any run of characters, dots included, and a '?' matches any one character.
+ * Patterns are compiled into a bit parallel automaton with one bit per pattern position, so
+ * matching takes one step per character of the name whatever the number of '*'. Patterns longer
+ * than the automaton can hold are matched by compare() instead.
+ */
+class globPattern
+{
+    typedef globPattern _Myt;
+
+public:
+
+    // ========================================================================
+    // CTOR / DTOR
+    // ========================================================================
+
+    /// Constructor.
+    /**
+     * @param[in] pattern  pattern with '*' and '?' wildcards
+     */
+    explicit globPattern( std::string_view pattern = std::string_view() );
+
+    // ========================================================================
+    // Properties
+    // ========================================================================
+
+    /// Retrieve pattern.
+    /**
+     * @return  pattern with consecutive '*' collapsed
+     */
+    const std::string& pattern() const {return pattern_;}
+
+    // ========================================================================
+    // Methods
+    // ========================================================================
+
+    /// Check if string matches pattern.
+    /**
+     * @param[in] s  string to compare
+     * @return  @c true if matched, @c false otherwise
+     */
+    bool matches( std::string_view s ) const;
+
+    // ========================================================================
+    // Static Methods
+    // ========================================================================
+
+    /// Compare string with wildcards to another string without compiling.
+    /**
+     * Backtracks to the last '*' only, so takes at most pattern times string length steps.
+     * @param[in] wild  string with '*' and '?' wildcards
+     * @param[in] s  string to compare
+     * @return  @c true if matched, @c false otherwise
+     */
+    static bool compare( std::string_view wild, std::string_view s );
+
+private:
+
+    static const std::size_t MAX_STATES = 63;
+
+    std::string pattern_;
+    bool compiled_;
+
+    std::uint64_t masks_[256];
+    std::uint64_t stars_;
+    std::uint64_t accept_;
+
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Logger name matcher class.
+/**
+ * Patterns are compiled once into a trie on the dot separated segments of their literal part.
+ * Each pattern with wildcards hangs off the node of the last whole segment before its first
+ * wildcard and only the rest of the name is matched against it, by a @c globPattern.
+ *
+ * When several patterns match, a name without wildcards wins. Otherwise the pattern with the
+ * longest literal prefix before its first wildcard wins, then the one with more literal
+ * characters, then the one sorting first. Matching walks down the trie once along the name and
+ * tries candidates on the way back up, most specific first.
+ */
+template <class T>
+class nameMatcher
+{
+    typedef nameMatcher<T> _Myt;
+
+public:
+
+    // ========================================================================
+    // Methods
+    // ========================================================================
+
+    /// Add pattern.
+    /**
+     * @param[in] pattern  name with '*' and '?' wildcards
+     * @param[in] value  value to return for names matching @p pattern
+     */
+    void add( std::string_view pattern, const T& value );
+
+    /// Find value of most specific pattern matching name.
+    /**
+     * @param[in] name  name to match
+     * @return  pointer to value, or @c nullptr if no pattern matched
+     */
+    const T *match( std::string_view name ) const {return match( root_, name, 0 );}
+
+private:
+
+    /// Pattern with wildcards.
+    struct candidate
+    {
+        globPattern glob;                           ///< rest of pattern from node on
+        std::size_t prefix;                         ///< literal characters before first wildcard
+        std::size_t literals;                       ///< literal characters in pattern
+        std::string pattern;                        ///< whole pattern
+        T value;                                    ///< value to return
+    };
+
+    /// Trie node.
+    struct node
+    {
+        std::map<std::string, std::unique_ptr<node>, std::less<>> children;
+
+        bool exact = false;                         ///< a pattern without wildcards ends here
+        T value = T();                              ///< value of that pattern
+
+        std::vector<candidate> globs;               ///< most specific first
+    };
+
+    node root_;
+
+    // ========================================================================
+
+    /// Find most specific pattern matching name from @p pos on.
+    const T *match( const node& n, std::string_view name, std::size_t pos ) const;
+
+    /// Order candidates, most specific first.
+    static bool moreSpecific( const candidate& lhs, const candidate& rhs );
+
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+template <class T>
+void nameMatcher<T>::add( std::string_view pattern, const T& value )
+{
+    const std::size_t wild( pattern.find_first_of( "*?" ) );
+    const bool plain( std::string_view::npos == wild );
+
+    // whole segments before the first wildcard go into the trie, all of them for a plain name
+    const std::size_t dot( plain ? pattern.size() : pattern.rfind( '.', wild ) );
+    node *n( &root_ );
+
+    if ( std::string_view::npos != dot )
+    {
+        const std::string_view literal( pattern.substr( 0, dot ) );
+
+        for ( std::size_t pos = 0; ; )
+        {
+            const std::size_t next( literal.find( '.', pos ) );
+            const std::string_view seg( literal.substr( pos, next - pos ) );
+
+            auto i( n->children.find( seg ) );
+
+            if ( n->children.end() == i )
+                i = n->children.emplace( std::string( seg ), std::unique_ptr<node>( new node() ) ).first;
+
+            n = i->second.get();
+
+            if ( std::string_view::npos == next )
+                break;
+
+            pos = next + 1;
+        }
+    }
+
+    if ( plain )
+    {
+        if ( !n->exact )
+        {
+            n->exact = true;
+            n->value = value;
+        }
+
+        return;
+    }
+
+    // the rest is matched from the start of the segment holding the first wildcard
+    const std::string_view rest( ( std::string_view::npos == dot ) ? pattern : pattern.substr( dot + 1 ) );
+
+    candidate c{globPattern( rest ), wild, 0, std::string( pattern ), value};
+
+    for ( char ch: pattern )
+        if (( '*' != ch ) && ( '?' != ch ))
+            ++c.literals;
+
+    n->globs.insert( std::upper_bound( n->globs.begin(), n->globs.end(), c, &moreSpecific ), std::move( c ) );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+template <class T>
+const T *nameMatcher<T>::match( const node& n, std::string_view name, std::size_t pos ) const
+{
+    // whole name used up by the trie
+    if ( name.size() < pos )
+        return ( n.exact ? &n.value : nullptr );
+
+    // deeper nodes have longer literal prefixes, try them first
+    std::size_t dot( name.find( '.', pos ) );
+
+    if ( std::string_view::npos == dot )
+        dot = name.size();
+
+    const auto i( n.children.find( name.substr( pos, dot - pos ) ) );
+
+    if ( n.children.end() != i )
+    {
+        const T *result( match( *i->second, name, dot + 1 ) );
+
+        if ( result )
+            return result;
+    }
+
+    const std::string_view rest( name.substr( pos ) );
+
+    for ( const candidate& c: n.globs )
+    {
+        if ( c.glob.matches( rest ) )
+            return &c.value;
+    }
+
+    return nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+template <class T>
+bool nameMatcher<T>::moreSpecific( const candidate& lhs, const candidate& rhs )
+{
+    if ( lhs.prefix != rhs.prefix )
+        return ( rhs.prefix < lhs.prefix );
+
+    if ( lhs.literals != rhs.literals )
+        return ( rhs.literals < lhs.literals );
+
+    return ( lhs.pattern < rhs.pattern );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace clio
+
+#endif // NAMEMATCHER_H
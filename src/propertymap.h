@@ -25,6 +25,7 @@
 #ifndef PROPERTYMAP_H
 #define PROPERTYMAP_H
 
+#include <atomic>
 #include <map>
 #include <sstream>
 
@@ -47,7 +48,7 @@ public:
     // ========================================================================
 
     /// Constructor.
-    propertyMap() : _Mybase() {}
+    propertyMap() : _Mybase(), version_( 0 ) {}
 
     /// Destructor.
     virtual ~propertyMap() {}
@@ -73,6 +74,40 @@ public:
     template <class T>
     void setProp( const std::string& name, const T& value );
 
+    /// Check if properties are the same as those of another map.
+    /**
+     * @param[in] other  property map to compare with
+     * @return  @c true if same, @c false otherwise
+     */
+    bool sameProperties( const propertyMap& other ) const {return ( static_cast<const _Mybase&>( *this ) == static_cast<const _Mybase&>( other ) );}
+
+    /// Retrieve number of times a property was set.
+    /**
+     * Lets users of derived objects notice changes without comparing every property.
+     *
+     * @return  version
+     */
+    unsigned int version() const {return version_.load( std::memory_order_acquire );}
+
+protected:
+
+    // ========================================================================
+    // Methods
+    // ========================================================================
+
+    /// Property was set.
+    /**
+     * Lets derived classes prepare anything they derive from a property once, instead of every
+     * time they use it.
+     *
+     * @param[in] name  property name
+     */
+    virtual void propertyChanged( const std::string& name ) {(void) name;}
+
+private:
+
+    std::atomic<unsigned int> version_;
+
 };
 
 template <class T>
@@ -136,6 +171,9 @@ void propertyMap::setProp( const std::string& name, const T& value )
     {
         i->second = strValue;
     }
+
+    propertyChanged( name );
+    version_.fetch_add( 1, std::memory_order_release );
 }
 
 /// Specialization for string properties.
@@ -150,6 +188,9 @@ inline void propertyMap::setProp( const std::string& name, const std::string& va
     {
         i->second = value;
     }
+
+    propertyChanged( name );
+    version_.fetch_add( 1, std::memory_order_release );
 }
 
 /// Specialization for boolean properties.
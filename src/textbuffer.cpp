@@ -0,0 +1,85 @@
+/**
+ * @file textbuffer.cpp
+ * @brief Text buffer classes.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "textbuffer.h"
+
+/// Clio namespace.
+namespace clio
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+textBuffer::~textBuffer()
+{
+    if ( spilled() )
+        delete [] data_;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void textBuffer::take( _Myt& rhs )
+{
+    // inline text has to be copied
+    if ( !rhs.spilled() )
+    {
+        assign( rhs.view() );
+        return;
+    }
+
+    if ( spilled() )
+        delete [] data_;
+
+    data_ = rhs.data_;
+    size_ = rhs.size_;
+    capacity_ = rhs.capacity_;
+
+    // leave other buffer empty
+    rhs.data_ = rhs.inline_;
+    rhs.size_ = 0;
+    rhs.capacity_ = rhs.inlineCapacity_;
+    rhs.data_[0] = '\0';
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void textBuffer::grow( std::size_t len )
+{
+    std::size_t capacity( 2 * capacity_ );
+
+    if ( capacity < len )
+        capacity = len;
+
+    char *data( new char[capacity + 1] );
+    std::memcpy( data, data_, size_ + 1 );
+
+    if ( spilled() )
+        delete [] data_;
+
+    data_ = data;
+    capacity_ = capacity;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace clio
@@ -0,0 +1,312 @@
+/**
+ * @file textbuffer.h
+ * @brief Text buffer classes.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TEXTBUFFER_H
+#define TEXTBUFFER_H
+
+#include "clioapi.h"
+
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+
+/// Clio namespace.
+namespace clio
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Text buffer base class.
+/**
+ * Growable character buffer that starts out in storage provided by a derived class and moves to
+ * the heap only when that fills up. Text is always null terminated.
+ */
+class CLIO_API textBuffer
+{
+    typedef textBuffer _Myt;
+
+public:
+
+    // ========================================================================
+    // Operators
+    // ========================================================================
+
+    /// Assignment operator.
+    /**
+     * @param[in] rhs  value to assign from
+     * @return  reference to @c this
+     */
+    _Myt& operator = ( const _Myt& rhs ) {assign( rhs.view() ); return *this;}
+
+    // ========================================================================
+    // Properties
+    // ========================================================================
+
+    /// Retrieve text.
+    /**
+     * @return  pointer to null terminated text
+     */
+    const char *data() const {return data_;}
+
+    /// Retrieve text length.
+    /**
+     * @return  length of text
+     */
+    std::size_t size() const {return size_;}
+
+    /// Check if empty.
+    /**
+     * @return  @c true if empty, @c false otherwise
+     */
+    bool empty() const {return ( 0 == size_ );}
+
+    /// Retrieve capacity.
+    /**
+     * @return  text length that fits without growing
+     */
+    std::size_t capacity() const {return capacity_;}
+
+    /// Check if text has moved to the heap.
+    /**
+     * @return  @c true if on heap, @c false otherwise
+     */
+    bool spilled() const {return ( data_ != inline_ );}
+
+    /// Retrieve text.
+    /**
+     * @return  text
+     */
+    std::string_view view() const {return std::string_view( data_, size_ );}
+
+    // ========================================================================
+    // Methods
+    // ========================================================================
+
+    /// Append text.
+    /**
+     * @param[in] value  text
+     * @param[in] len  length of text
+     */
+    void append( const char *value, std::size_t len )
+    {
+        std::memcpy( prepare( len ), value, len );
+        commit( len );
+    }
+
+    /// Append text.
+    /**
+     * @param[in] value  text
+     */
+    void append( std::string_view value ) {append( value.data(), value.size() );}
+
+    /// Append character.
+    /**
+     * @param[in] value  character
+     */
+    void append( char value )
+    {
+        *prepare( 1 ) = value;
+        commit( 1 );
+    }
+
+    /// Replace text.
+    /**
+     * @param[in] value  text
+     */
+    void assign( std::string_view value )
+    {
+        clear();
+        append( value );
+    }
+
+    /// Clear text.
+    void clear()
+    {
+        size_ = 0;
+        data_[0] = '\0';
+    }
+
+    /// Retrieve space for writing text directly into the buffer.
+    /**
+     * Follow up with commit() to keep what was written.
+     *
+     * @param[in] len  number of characters that will be written
+     * @return  pointer to space for at least @p len characters
+     */
+    char *prepare( std::size_t len )
+    {
+        if ( capacity_ - size_ < len )
+            grow( size_ + len );
+
+        return ( data_ + size_ );
+    }
+
+    /// Keep text written into space from prepare().
+    /**
+     * @param[in] len  number of characters written
+     */
+    void commit( std::size_t len )
+    {
+        size_ += len;
+        data_[size_] = '\0';
+    }
+
+    /// Ensure capacity.
+    /**
+     * @param[in] len  text length that should fit without growing
+     */
+    void reserve( std::size_t len )
+    {
+        if ( capacity_ < len )
+            grow( len );
+    }
+
+protected:
+
+    // ========================================================================
+    // CTOR / DTOR
+    // ========================================================================
+
+    /// Constructor.
+    /**
+     * @param[in] storage  initial storage
+     * @param[in] storageLen  size of initial storage (including null terminator)
+     */
+    textBuffer( char *storage, std::size_t storageLen ) :
+        data_( storage ),
+        inline_( storage ),
+        inlineCapacity_( storageLen - 1 ),
+        size_( 0 ),
+        capacity_( storageLen - 1 )
+    {
+        data_[0] = '\0';
+    }
+
+    /// Destructor.
+    ~textBuffer();
+
+    // ========================================================================
+    // Methods
+    // ========================================================================
+
+    /// Take heap text from another buffer, or copy it if inline.
+    void take( _Myt& rhs );
+
+private:
+
+    char *data_;
+
+    char *inline_;
+    std::size_t inlineCapacity_;
+
+    std::size_t size_;
+    std::size_t capacity_;
+
+    // ========================================================================
+
+    /// Grow buffer.
+    void grow( std::size_t len );
+
+    // not implemented
+    textBuffer( const _Myt& ) = delete;
+
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Text buffer with inline storage.
+/**
+ * Text up to @p N - 1 characters long is kept inside the object itself, longer text moves to the
+ * heap.
+ */
+template <std::size_t N>
+class inlineTextBuffer : public textBuffer
+{
+    typedef inlineTextBuffer<N> _Myt;
+    typedef textBuffer _Mybase;
+
+public:
+
+    // ========================================================================
+    // CTOR / DTOR
+    // ========================================================================
+
+    /// Constructor.
+    inlineTextBuffer() :
+        _Mybase( storage_, N )
+    {
+    }
+
+    /// Constructor.
+    /**
+     * @param[in] rhs  object to copy
+     */
+    inlineTextBuffer( const _Myt& rhs ) :
+        _Mybase( storage_, N )
+    {
+        append( rhs.view() );
+    }
+
+    /// Constructor.
+    /**
+     * @param[in] rhs  object to move
+     */
+    inlineTextBuffer( _Myt&& rhs ) :
+        _Mybase( storage_, N )
+    {
+        take( rhs );
+    }
+
+    /// Destructor.
+    ~inlineTextBuffer() {}
+
+    // ========================================================================
+    // Operators
+    // ========================================================================
+
+    /// Assignment operator.
+    /**
+     * @param[in] rhs  value to assign from
+     * @return  reference to @c this
+     */
+    _Myt& operator = ( const _Myt& rhs ) {assign( rhs.view() ); return *this;}
+
+    /// Assignment operator.
+    /**
+     * @param[in] rhs  value to move from
+     * @return  reference to @c this
+     */
+    _Myt& operator = ( _Myt&& rhs ) {take( rhs ); return *this;}
+
+private:
+
+    char storage_[N];
+
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace clio
+
+#endif // TEXTBUFFER_H
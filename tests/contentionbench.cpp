@@ -0,0 +1,99 @@
+/**
+ * @file contentionbench.cpp
+ * @brief Appender lock contention benchmark.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "clio.h"
+#include "appenders/fileappender.h"
+#include "layouts/patternlayout.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// Worker class, so the pattern has a class name to render.
+struct worker
+{
+    /// Log @p count lines.
+    static void run( int id, long count )
+    {
+        for ( long n = 0; n < count; ++n )
+            LOG_INFO << "worker " << id << " line " << n;
+    }
+};
+
+/**
+ * Logs buffered INFO lines with a pattern that is costly to format from 1 to 64 threads into one
+ * file appender. Formatting runs before the appender lock is taken, so with enough cores records
+ * per second should rise with the thread count until the file buffer copy dominates.
+ *
+ * Usage: contentionbench [records] [file]
+ */
+int main( int argc, char **argv )
+{
+    const long records( ( 1 < argc ) ? std::atol( argv[1] ) : 200000 );
+    const std::string file( ( 2 < argc ) ? argv[2] : "contentionbench.log" );
+
+    const bool ok( clio::config()
+        .appender<clio::fileAppender>( "file" )
+            .set( clio::fileAppender::PROP_FILE, file )
+            .set( clio::fileAppender::PROP_APPENDTOFILE, false )
+            .layout<clio::patternLayout>( "%date [%thread] %level{%-5.5s} %class{%-15.15s} - %message%newline" )
+        .root( clio::logLevel::Info, {"file"} )
+        .apply() );
+
+    if ( !ok )
+        return 1;
+
+    std::printf( "%8s %12s  (%u hardware threads)\n", "threads", "records/s", std::thread::hardware_concurrency() );
+
+    for ( const int threads: {1, 2, 4, 8, 16, 32, 64} )
+    {
+        const long each( records / threads );
+
+        std::vector<std::thread> workers;
+
+        const auto start( std::chrono::steady_clock::now() );
+
+        for ( int t = 0; t < threads; ++t )
+            workers.emplace_back( &worker::run, t, each );
+
+        for ( std::thread& w: workers )
+            w.join();
+
+        const std::chrono::duration<double> elapsed( std::chrono::steady_clock::now() - start );
+
+        std::printf( "%8d %12.0f\n", threads, ( each * threads ) / elapsed.count() );
+    }
+
+    CLIO_FINALIZE
+
+    return 0;
+}
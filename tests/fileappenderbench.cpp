@@ -0,0 +1,95 @@
+/**
+ * @file fileappenderbench.cpp
+ * @brief File appender group commit benchmark.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "clio.h"
+#include "appenders/fileappender.h"
+#include "layouts/patternlayout.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Logs ERROR lines, each of which must reach the file before the statement returns, from 1 to 64
+ * threads into one file appender. Threads arriving while a write is in flight share the next one,
+ * so records per second should rise with the thread count instead of staying flat.
+ *
+ * Usage: fileappenderbench [records] [file]
+ */
+int main( int argc, char **argv )
+{
+    const long records( ( 1 < argc ) ? std::atol( argv[1] ) : 200000 );
+    const std::string file( ( 2 < argc ) ? argv[2] : "fileappenderbench.log" );
+
+    const bool ok( clio::config()
+        .appender<clio::fileAppender>( "file" )
+            .set( clio::fileAppender::PROP_FILE, file )
+            .set( clio::fileAppender::PROP_APPENDTOFILE, false )
+            .set( clio::fileAppender::PROP_IMMEDIATEFLUSHLEVEL, clio::logLevel::Error )
+            .layout<clio::patternLayout>( "%date [%thread] %level %message%newline" )
+        .root( clio::logLevel::Error, {"file"} )
+        .apply() );
+
+    if ( !ok )
+        return 1;
+
+    std::printf( "%8s %12s\n", "threads", "records/s" );
+
+    for ( const int threads: {1, 2, 4, 8, 16, 32, 64} )
+    {
+        const long each( records / threads );
+
+        std::vector<std::thread> workers;
+
+        const auto start( std::chrono::steady_clock::now() );
+
+        for ( int t = 0; t < threads; ++t )
+        {
+            workers.emplace_back( [t, each]
+            {
+                for ( long n = 0; n < each; ++n )
+                    LOG_ERROR_F( "worker {} line {}", t, n );
+            } );
+        }
+
+        for ( std::thread& w: workers )
+            w.join();
+
+        const std::chrono::duration<double> elapsed( std::chrono::steady_clock::now() - start );
+
+        std::printf( "%8d %12.0f\n", threads, ( each * threads ) / elapsed.count() );
+    }
+
+    CLIO_FINALIZE
+
+    return 0;
+}
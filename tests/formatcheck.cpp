@@ -0,0 +1,73 @@
+/**
+ * @file formatcheck.cpp
+ * @brief Checks of brace format output.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "formatstring.h"
+#include "textbuffer.h"
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+/// Number of failed checks.
+static int failures( 0 );
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+template <class... Args, class... A>
+static void check( std::string_view expected, const clio::formatString<Args...>& format, const A&... args )
+{
+    clio::inlineTextBuffer<256> out;
+    format.append( out, args... );
+
+    if ( expected != out.view() )
+    {
+        std::fprintf( stderr, "\"%.*s\": expected \"%.*s\", got \"%.*s\"\n",
+            (int) format.text().size(), format.text().data(),
+            (int) expected.size(), expected.data(),
+            (int) out.view().size(), out.view().data() );
+
+        ++failures;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    // booleans read the same with or without a spec, as std::format writes them
+    static constexpr clio::formatString<bool, bool> boolFields( "[{}] [{:>6}]" );
+    check( "[true] [  true]", boolFields, true, true );
+    check( "[false] [ false]", boolFields, false, false );
+
+    static constexpr clio::formatString<int, int, unsigned> intFields( "{} {:+05d} {:x}" );
+    check( "42 -0042 ff", intFields, 42, -42, 255u );
+
+    static constexpr clio::formatString<double, const char*> mixedFields( "{{{:.2f}}} {:<4}|" );
+    check( "{3.14} ab  |", mixedFields, 3.14159, "ab" );
+
+    return ( failures ? 1 : 0 );
+}
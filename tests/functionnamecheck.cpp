@@ -0,0 +1,59 @@
+/**
+ * @file functionnamecheck.cpp
+ * @brief Checks of function name parsing.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "functionname.h"
+
+#include <string_view>
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+static constexpr bool parses( std::string_view function, std::string_view moduleName, std::string_view className, std::string_view classFunction )
+{
+    const clio::functionName name( function );
+
+    return (( moduleName == name.moduleName() ) && ( className == name.className() ) && ( classFunction == name.classFunction() ));
+}
+
+// parsing is constexpr, so these are checked when compiling
+static_assert( parses( "void a::b::c::foo( int bar )", "b", "c", "foo" ) );
+static_assert( parses( "void foo()", "", "", "foo" ) );
+static_assert( parses( "std::vector<std::pair<int, int> > a::b<std::map<int, int>>::get() const", "a", "b<std::map<int, int>>", "get" ) );
+
+// operator symbols are not template brackets
+static_assert( parses( "std::istream& foo::operator>>(std::istream&, int)", "", "foo", "operator>>" ) );
+static_assert( parses( "bool foo::operator>(const foo&) const", "", "foo", "operator>" ) );
+static_assert( parses( "bar* foo::operator->()", "", "foo", "operator->" ) );
+static_assert( parses( "bool ns::foo<int>::operator<(const ns::foo<int>&) const", "ns", "foo<int>", "operator<" ) );
+static_assert( parses( "foo& foo::operator>>=(int)", "", "foo", "operator>>=" ) );
+static_assert( parses( "int foo::operator()(int)", "", "foo", "operator()" ) );
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    return 0;
+}
@@ -0,0 +1,170 @@
+/**
+ * @file namematchercheck.cpp
+ * @brief Checks of logger name matching.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "namematcher.h"
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+/// Number of failed checks.
+static int failures( 0 );
+
+/// Sixty one characters, two more fill the automaton and longer patterns are matched by compare().
+#define LONG_TAIL "service.subsystem.component.module.handler.request.response.v"
+
+/// Glob pattern cases.
+static const struct
+{
+    const char *pattern;
+    const char *name;
+    bool matches;
+} GLOBS[] =
+{
+    {"",                        "",             true},
+    {"",                        "a",            false},
+    {"*",                       "",             true},
+    {"*",                       "a.b.c",        true},
+    {"?",                       "",             false},
+    {"?",                       "a",            true},
+    {"?",                       "ab",           false},
+    {"a?c",                     "abc",          true},
+    {"a?c",                     "ac",           false},
+    {"a?c",                     "a.c",          true},
+    {"a*b",                     "ab",           true},
+    {"a*b",                     "a.x.b",        true},
+    {"a*b",                     "a.x.bc",       false},
+    {"a**b",                    "axb",          true},
+    {"*a*b*c*",                 "xaybzc",       true},
+    {"*a*b*c*",                 "xaybz",        false},
+    {"*.b",                     "a.b",          true},
+    {"*.b",                     ".b",           true},
+    {"*.b",                     "ab",           false},
+    {"a.*?",                    "a.",           false},
+    {"a.*?",                    "a.b",          true},
+    {"*." LONG_TAIL,            "x." LONG_TAIL, true},           // compiled, full
+    {"*." LONG_TAIL,            "x." LONG_TAIL "s", false},
+    {"?." LONG_TAIL "*",        "x." LONG_TAIL ".tail", true},   // compared
+    {"?." LONG_TAIL "*",        "xy." LONG_TAIL, false},
+    {"*.*." LONG_TAIL "?",      "a.b." LONG_TAIL "s", true},
+    {"*.*." LONG_TAIL "?",      "a." LONG_TAIL "s", false}
+};
+
+/// Patterns added to the name matcher, each matching to itself.
+static const char *const PATTERNS[] =
+{
+    "a",
+    "a.b",
+    "a.*",
+    "a.b*",
+    "*.b",
+    "a.?.c",
+    "x?z",
+    "net.conn.*",
+    "net.*.send",
+    "*." LONG_TAIL,
+    "*.*." LONG_TAIL "?"
+};
+
+/// Name matcher cases, most specific pattern wins.
+static const struct
+{
+    const char *name;
+    const char *pattern;
+} NAMES[] =
+{
+    {"a",                       "a"},           // exact
+    {"a.b",                     "a.b"},         // exact beats every wildcard
+    {"a.c",                     "a.*"},
+    {"a.",                      "a.*"},
+    {"a.bc",                    "a.b*"},        // longer literal prefix
+    {"a.b.b",                   "a.b*"},        // '*' spans dots
+    {"a.x.c",                   "a.?.c"},       // same prefix, more literal characters
+    {"a.xy.c",                  "a.*"},         // '?' is one character
+    {"q.b",                     "*.b"},
+    {"q.r.b",                   "*.b"},
+    {"ab",                      nullptr},
+    {"b",                       nullptr},
+    {"",                        nullptr},
+    {"xyz",                     "x?z"},
+    {"xz",                      nullptr},
+    {"xyyz",                    nullptr},
+    {"net.conn.send",           "net.conn.*"},
+    {"net.udp.send",            "net.*.send"},
+    {"net.udp.recv",            nullptr},
+    {"x." LONG_TAIL,            "*." LONG_TAIL},
+    {"x." LONG_TAIL ".b",       "*.b"},
+    {"q.b." LONG_TAIL "s",      "*.*." LONG_TAIL "?"}
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+static void checkGlob( const char *pattern, const char *name, bool expected )
+{
+    const bool compiled( clio::globPattern( pattern ).matches( name ) );
+    const bool compared( clio::globPattern::compare( pattern, name ) );
+
+    if (( expected != compiled ) || ( expected != compared ))
+    {
+        std::fprintf( stderr, "\"%s\" on \"%s\": expected %d, matches() %d, compare() %d\n",
+            pattern, name, expected, compiled, compared );
+
+        ++failures;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    for ( const auto& g: GLOBS )
+        checkGlob( g.pattern, g.name, g.matches );
+
+    clio::nameMatcher<std::string> matcher;
+
+    for ( const char *p: PATTERNS )
+        matcher.add( p, p );
+
+    for ( const auto& n: NAMES )
+    {
+        const std::string *found( matcher.match( n.name ) );
+        const std::string_view got( found ? std::string_view( *found ) : "(none)" );
+        const std::string_view expected( n.pattern ? n.pattern : "(none)" );
+
+        if ( expected != got )
+        {
+            std::fprintf( stderr, "\"%s\": expected \"%.*s\", got \"%.*s\"\n",
+                n.name,
+                (int) expected.size(), expected.data(),
+                (int) got.size(), got.data() );
+
+            ++failures;
+        }
+    }
+
+    return ( failures ? 1 : 0 );
+}
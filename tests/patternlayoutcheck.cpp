@@ -0,0 +1,198 @@
+/**
+ * @file patternlayoutcheck.cpp
+ * @brief Checks of pattern layout output.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "layouts/patternlayout.h"
+#include "logline.h"
+#include "logrecord.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <string>
+#include <string_view>
+
+/// Number of failed checks.
+static int failures( 0 );
+
+/// Time stamps in milliseconds since epoch, crossing quarter hours and daylight saving changes.
+static const long long STAMPS[] =
+{
+    1792167299178,      // 2026-10-16 16:14:59.178 UTC
+    1792167300002,      // next quarter hour
+    1792167300999,      // same second
+    1772953199500,      // 2026-03-08 06:59:59.500 UTC, last second of EST
+    1772953200000,      // first second of EDT
+    1793512799250,      // 2026-11-01 05:59:59.250 UTC, last second of EDT
+    1793512800750,      // first second of EST
+    1792167299001       // back before the quarter hour
+};
+
+static const std::size_t COUNT = sizeof(STAMPS) / sizeof(STAMPS[0]);
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+static void compare( const char *pattern, long long stamp, std::string_view expected, std::string_view got, const char *path )
+{
+    if ( expected != got )
+    {
+        std::fprintf( stderr, "\"%s\" at %lld by %s: expected \"%.*s\", got \"%.*s\"\n",
+            pattern, stamp, path,
+            (int) expected.size(), expected.data(),
+            (int) got.size(), got.data() );
+
+        ++failures;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+static void check( const char *pattern, const char *const (&expected)[COUNT] )
+{
+    clio::patternLayout l;
+    l.setConversionPattern( pattern );
+
+    for ( std::size_t i = 0; i < COUNT; ++i )
+    {
+        clio::logLine line( clio::logLevel::Warning, "src/net/conn.cpp", "void net::conn::handler::send(int) const", 128 );
+        line.setText( std::string( "sent 42 bytes" ) );
+        line.setThreadId( 0x1a2b );
+        line.setTimeStamp( std::chrono::system_clock::time_point( std::chrono::milliseconds( STAMPS[i] ) ) );
+
+        // every way of formatting renders the same
+        const clio::layout& base( l );
+        compare( pattern, STAMPS[i], expected[i], base.format( line ), "line" );
+
+        std::string out;
+        l.formatTo( line.record(), out );
+        compare( pattern, STAMPS[i], expected[i], out, "string" );
+
+        clio::lineSegments segments;
+        l.formatTo( line.record(), segments );
+        compare( pattern, STAMPS[i], expected[i], segments.view(), "segments" );
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+static void check( const char *pattern, const char *expected )
+{
+    const char *const all[COUNT] = {expected, expected, expected, expected, expected, expected, expected, expected};
+
+    check( pattern, all );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    // rules in the zone itself, no time zone database needed
+    setenv( "TZ", "EST5EDT,M3.2.0,M11.1.0", 1 );
+    tzset();
+
+    // values other than dates, output of the layout before it was compiled
+    check( "%level{%-7s}|%levelnum{%03d}|%module|%class{%-8.8s}|%method{%.3s}",
+        "WARN   |003|conn|handler |sen" );
+    check( "[%level] %levelnum %module{%.2s} %class.%method %file:%linenum %message%newline",
+        "[WARN] 3 co handler.send src/net/conn.cpp:128 sent 42 bytes\n" );
+    check( "%file{%.7s}|%linenum{%05u}|%message{%.4s}", "src/net|00128|sent" );
+    check( "plain text, no values", "plain text, no values" );
+
+    check( "%thread|%epoch{%011lld}|%epochms",
+    {
+        "6699|01792167299|1792167299178",
+        "6699|01792167300|1792167300002",
+        "6699|01792167300|1792167300999",
+        "6699|01772953199|1772953199500",
+        "6699|01772953200|1772953200000",
+        "6699|01793512799|1793512799250",
+        "6699|01793512800|1793512800750",
+        "6699|01792167299|1792167299001"
+    } );
+
+    check( "%thread{%08x}|%epoch|%epochms{%015lld}",
+    {
+        "00001a2b|1792167299|001792167299178",
+        "00001a2b|1792167300|001792167300002",
+        "00001a2b|1792167300|001792167300999",
+        "00001a2b|1772953199|001772953199500",
+        "00001a2b|1772953200|001772953200000",
+        "00001a2b|1793512799|001793512799250",
+        "00001a2b|1793512800|001793512800750",
+        "00001a2b|1792167299|001792167299001"
+    } );
+
+    // local dates, rendered once per second and with the zone offset kept for a quarter hour
+    check( "%date",
+    {
+        "10/16/2026 12:14:59.178",
+        "10/16/2026 12:15:00.002",
+        "10/16/2026 12:15:00.999",
+        "03/08/2026 01:59:59.500",
+        "03/08/2026 03:00:00.000",
+        "11/01/2026 01:59:59.250",
+        "11/01/2026 01:00:00.750",
+        "10/16/2026 12:14:59.001"
+    } );
+
+    check( "%date{%Y%m%d %H%M%S%L}",
+    {
+        "20261016 121459178",
+        "20261016 121500002",
+        "20261016 121500999",
+        "20260308 015959500",
+        "20260308 030000000",
+        "20261101 015959250",
+        "20261101 010000750",
+        "20261016 121459001"
+    } );
+
+    check( "%date{%a %b %d %j %Z %z %L}",
+    {
+        "Fri Oct 16 289 EDT -0400 178",
+        "Fri Oct 16 289 EDT -0400 002",
+        "Fri Oct 16 289 EDT -0400 999",
+        "Sun Mar 08 067 EST -0500 500",
+        "Sun Mar 08 067 EDT -0400 000",
+        "Sun Nov 01 305 EDT -0400 250",
+        "Sun Nov 01 305 EST -0500 750",
+        "Fri Oct 16 289 EDT -0400 001"
+    } );
+
+    // UTC next to local time
+    check( "%utcdate|%date{ISO8601}|%utcdate{ISO8601}|%utcdate{%H:%M:%S.%L %Z}",
+    {
+        "10/16/2026 16:14:59.178|2026-10-16T12:14:59.178-0400|2026-10-16T16:14:59.178Z|16:14:59.178 GMT",
+        "10/16/2026 16:15:00.002|2026-10-16T12:15:00.002-0400|2026-10-16T16:15:00.002Z|16:15:00.002 GMT",
+        "10/16/2026 16:15:00.999|2026-10-16T12:15:00.999-0400|2026-10-16T16:15:00.999Z|16:15:00.999 GMT",
+        "03/08/2026 06:59:59.500|2026-03-08T01:59:59.500-0500|2026-03-08T06:59:59.500Z|06:59:59.500 GMT",
+        "03/08/2026 07:00:00.000|2026-03-08T03:00:00.000-0400|2026-03-08T07:00:00.000Z|07:00:00.000 GMT",
+        "11/01/2026 05:59:59.250|2026-11-01T01:59:59.250-0400|2026-11-01T05:59:59.250Z|05:59:59.250 GMT",
+        "11/01/2026 06:00:00.750|2026-11-01T01:00:00.750-0500|2026-11-01T06:00:00.750Z|06:00:00.750 GMT",
+        "10/16/2026 16:14:59.001|2026-10-16T12:14:59.001-0400|2026-10-16T16:14:59.001Z|16:14:59.001 GMT"
+    } );
+
+    return ( failures ? 1 : 0 );
+}
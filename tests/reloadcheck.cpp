@@ -0,0 +1,166 @@
+/**
+ * @file reloadcheck.cpp
+ * @brief Checks of appenders and loggers kept across reconfiguration.
+ *
+ * @section Copyright
+ * Copyright (C) 2026 Randy Blankley
+ *
+ * @section License
+ * This file is part of libclio.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "appenders/fileappender.h"
+#include "clio.h"
+#include "configbuilder.h"
+#include "layouts/patternlayout.h"
+#include "logger.h"
+#include "loggermanager.h"
+#include "logline.h"
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/// Number of failed checks.
+static int failures( 0 );
+
+/// Written right away, truncated when opened.
+static const char *KEEP_FILE = "reloadcheck_keep.log";
+
+/// Buffered until closed.
+static const char *CHANGE_FILE = "reloadcheck_change.log";
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+static void check( bool passed, const char *what )
+{
+    if ( !passed )
+    {
+        std::fprintf( stderr, "failed: %s\n", what );
+        ++failures;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+static std::string contents( const char *filename )
+{
+    std::ifstream in( filename );
+    std::ostringstream out;
+    out << in.rdbuf();
+
+    return out.str();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+static clio::configBuilder describe( const char *changePattern )
+{
+    return clio::config()
+        .appender<clio::fileAppender>( "keep" )
+            .set( clio::fileAppender::PROP_FILE, KEEP_FILE )
+            .set( clio::fileAppender::PROP_APPENDTOFILE, false )
+            .set( clio::fileAppender::PROP_BUFFERSIZE, 0 )
+            .layout<clio::patternLayout>( "%message%newline" )
+        .appender<clio::fileAppender>( "change" )
+            .set( clio::fileAppender::PROP_FILE, CHANGE_FILE )
+            .set( clio::fileAppender::PROP_APPENDTOFILE, false )
+            .set( clio::fileAppender::PROP_BUFFERSIZE, 65536 )
+            .set( clio::fileAppender::PROP_FLUSHINTERVAL, 0 )
+            .set( clio::fileAppender::PROP_IMMEDIATEFLUSHLEVEL, clio::logLevel::Fatal )
+            .layout<clio::patternLayout>( changePattern )
+        .root( clio::logLevel::Info, {"keep", "change"} );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+static std::vector<clio::appenderWeakPtr> rootAppenders()
+{
+    const clio::loggerPtr root( clio::loggerManager::current()->find( "reloadcheck" ).lock() );
+    const clio::appenderWeakPtrList result( root ? root->appenders() : clio::appenderWeakPtrList() );
+
+    return std::vector<clio::appenderWeakPtr>( result.begin(), result.end() );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::remove( KEEP_FILE );
+    std::remove( CHANGE_FILE );
+
+    check( describe( "%message%newline" ).apply(), "first configuration applied" );
+
+    const std::vector<clio::appenderWeakPtr> first( rootAppenders() );
+    check( 2 == first.size(), "root logger writes to both appenders" );
+
+    if ( 2 != first.size() )
+        return 1;
+
+    LOG_INFO << "one";
+
+    // log line built by hand, outliving its configuration
+    std::unique_ptr<clio::logLine> held( new clio::logLine( clio::logLevel::Info, __FILE__, __PRETTY_FUNCTION__, __LINE__ ) );
+    held->setText( std::string( "held" ) );
+
+    check( "one\n" == contents( KEEP_FILE ), "unbuffered line written" );
+    check( contents( CHANGE_FILE ).empty(), "buffered line not written yet" );
+
+    // unchanged twice, nothing is reopened or closed
+    for ( int i = 0; i < 2; ++i )
+    {
+        check( describe( "%message%newline" ).apply(), "unchanged configuration applied" );
+
+        const std::vector<clio::appenderWeakPtr> same( rootAppenders() );
+        check(( 2 == same.size() ) && ( same[0].lock() == first[0].lock() ) && ( same[1].lock() == first[1].lock() ), "unchanged appenders kept" );
+    }
+
+    check( "one\n" == contents( KEEP_FILE ), "kept file not truncated" );
+    check( contents( CHANGE_FILE ).empty(), "kept buffer not flushed" );
+
+    LOG_INFO << "two";
+
+    // changed appender is closed, the other one kept
+    check( describe( "[%message]%newline" ).apply(), "changed configuration applied" );
+
+    const std::vector<clio::appenderWeakPtr> next( rootAppenders() );
+    check(( 2 == next.size() ) && ( next[0].lock() == first[0].lock() ), "unchanged appender kept" );
+    check( "one\ntwo\n" == contents( CHANGE_FILE ), "changed appender closed" );
+
+    LOG_INFO << "three";
+
+    // its logger was dropped from the configuration and let go of the appenders, which are freed
+    // along with it
+    check( !first[1].expired(), "changed appender held by the logger of the held line" );
+
+    held.reset();
+
+    check( first[1].expired(), "changed appender freed with the held line" );
+    check( "one\ntwo\nthree\n" == contents( KEEP_FILE ), "held line dropped, kept file written throughout" );
+
+    clioFinalize();
+
+    // the new appender truncated the file before the old one wrote out its last lines
+    check( "one\ntwo\n[three]\n" == contents( CHANGE_FILE ), "new appender closed" );
+
+    std::remove( KEEP_FILE );
+    std::remove( CHANGE_FILE );
+
+    return ( failures ? 1 : 0 );
+}